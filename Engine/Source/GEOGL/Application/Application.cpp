@@ -26,6 +26,7 @@
 #include "Application.hpp"
 #include "../Rendering/Renderer.hpp"
 #include "../Rendering/Renderer2D.hpp"
+#include "../Rendering/RenderThread.hpp"
 #include "../IO/Input.hpp"
 #include <fstream>
 
@@ -33,6 +34,10 @@ namespace GEOGL{
 
     Application* Application::s_Instance = nullptr;
 
+    /* LoopMode::ON_DEMAND wakes at least this often, and every event draws a few frames so ImGui can settle */
+    static const float s_OnDemandWaitTimeout = 0.5f;
+    static const uint32_t s_EventRedrawFrames = 3;
+
 
 
     Application::Application(const ApplicationProperties& props){
@@ -57,7 +62,7 @@ namespace GEOGL{
                 m_Settings.flush();
             }
 
-            m_Settings.data["RenderingAPI"]["Info"] = "The RenderingAPI is a bit switched flag, such that 0 is invalid, 1 is OpenGL, 2 is Vulkan, 4 is DirectX11, 8 is DirectX12, 16 is Metal, and so on. This is done to automatically detect the best way to open Windows.";
+            m_Settings.data["RenderingAPI"]["Info"] = "The RenderingAPI is a bit switched flag, such that 0 is invalid, 1 is OpenGL, 2 is Vulkan, 4 is DirectX11, 8 is DirectX12, 16 is Metal, 32 is Null (headless, draws nothing), and so on. This is done to automatically detect the best way to open Windows.";
 
         }
         /* if doesn't have api */
@@ -91,8 +96,35 @@ namespace GEOGL{
         if(!props.appIconPath.empty())
             m_Window->setWindowIcon(props.applicationResourceDirectory + "/" + props.appIconPath);
 
+        /* Let settings.json tune the batches per machine */
+        Renderer2D::BatchProperties batchProperties = props.renderer2DBatchProperties;
+        if(m_Settings.data.contains("Renderer2D")){
+            const auto& renderer2DSettings = m_Settings.data["Renderer2D"];
+            batchProperties.maxQuads = renderer2DSettings.value("MaxQuads", batchProperties.maxQuads);
+            batchProperties.maxTextureSlots = renderer2DSettings.value("MaxTextureSlots", batchProperties.maxTextureSlots);
+            batchProperties.adaptiveBatchSize = renderer2DSettings.value("AdaptiveBatchSize", batchProperties.adaptiveBatchSize);
+            batchProperties.textureBinding = (Renderer2D::TextureBinding) renderer2DSettings.value("TextureBinding", (int) batchProperties.textureBinding);
+            batchProperties.vertexFormat = (Renderer2D::VertexFormat) renderer2DSettings.value("VertexFormat", (int) batchProperties.vertexFormat);
+        }
+
+        /* Let settings.json pick how the loop runs per machine */
+        m_LoopMode = props.loopMode;
+        m_UnfocusedFrameRate = props.unfocusedFrameRate;
+        bool renderThread = props.renderThread;
+        uint32_t framesInFlight = props.framesInFlight;
+        if(m_Settings.data.contains("Application")){
+            const auto& applicationSettings = m_Settings.data["Application"];
+            m_LoopMode = (LoopMode) applicationSettings.value("LoopMode", (int) m_LoopMode);
+            m_UnfocusedFrameRate = applicationSettings.value("UnfocusedFrameRate", m_UnfocusedFrameRate);
+            renderThread = applicationSettings.value("RenderThread", renderThread);
+            framesInFlight = applicationSettings.value("FramesInFlight", framesInFlight);
+        }
+
+        /* The buffers pick how they stream when they are created, so this has to be known before the Renderer is */
+        RenderThread::setEnabled(renderThread, framesInFlight);
+
         /* Initialize Renderer */
-        Renderer::init(props.applicationResourceDirectory);
+        Renderer::init(batchProperties);
 
         /* Initialize ImGuiLayer */
         m_ImGuiLayer = new ImGuiLayer;
@@ -114,11 +146,22 @@ namespace GEOGL{
         setUpImGui(ImGuiLayer::getImGuiContext());
 
         GEOGL::Renderer::setClearColor({0.1f,0.1f,0.1f,1.0f});
+
+        /* From here on, the main thread only records frames, and the render thread owns the context */
+        RenderThread::start(m_Window->getGraphicsContext());
+
         GEOGL_CORE_INFO_NOSTRIP("Successfully started application. Entering Loop.");
 
         while(m_Running){
             GEOGL_PROFILE_SCOPE("Run Loop");
 
+            /* Sleep until something needs drawing. The time spent asleep is not part of the next time step */
+            if(m_LoopMode == LoopMode::ON_DEMAND && (m_RedrawFrames == 0 || m_Minimized)){
+                m_Window->waitEvents(s_OnDemandWaitTimeout);
+                m_LastFrameTime = m_Window->getCurrentPlatformTime();
+                continue;
+            }
+
             /* Measure platform time */
             float time = m_Window->getCurrentPlatformTime();
             TimeStep timeStep = time - m_LastFrameTime;
@@ -149,15 +192,42 @@ namespace GEOGL{
                 m_ImGuiLayer->end();
             }
 
+            if(m_RedrawFrames > 0)
+                --m_RedrawFrames;
+
             m_Window->onUpdate();
+            RenderThread::endFrame();
+
+            /* Throttle windows in the background */
+            if(!m_Focused && m_UnfocusedFrameRate){
+                float frameTime = m_Window->getCurrentPlatformTime() - time;
+                float minimumFrameTime = 1.0f / (float) m_UnfocusedFrameRate;
+                if(frameTime < minimumFrameTime)
+                    std::this_thread::sleep_for(std::chrono::duration<float>(minimumFrameTime - frameTime));
+            }
 
         }
 
+        /* Layers and the window are destroyed after this, and need the context back on this thread to do it */
+        RenderThread::stop();
+
+    }
+
+    void Application::requestRedraw(uint32_t frames){
+
+        uint32_t redrawFrames = m_RedrawFrames.load();
+        while(redrawFrames < frames && !m_RedrawFrames.compare_exchange_weak(redrawFrames, frames));
+
+        if(m_LoopMode == LoopMode::ON_DEMAND && m_Window)
+            m_Window->postEmptyEvent();
+
     }
 
     void Application::eventCallback(Event& event){
         GEOGL_PROFILE_FUNCTION();
 
+        requestRedraw(s_EventRedrawFrames);
+
         /* Firstly, call the application's on event function, which may do other things, such as push or pop layers */
         onEvent(event);
         if(event.Handled)
@@ -168,6 +238,8 @@ namespace GEOGL{
         /* Bind a Window Close Event to Application::onWindowClose() */
         dispatcher.dispatch<WindowCloseEvent>(GEOGL_BIND_EVENT_FN(Application::onWindowClose)); // NOLINT(modernize-avoid-bind)
         dispatcher.dispatch<WindowResizeEvent>(GEOGL_BIND_EVENT_FN(Application::onWindowResize));
+        dispatcher.dispatch<WindowFocusEvent>(GEOGL_BIND_EVENT_FN(Application::onWindowFocus));
+        dispatcher.dispatch<WindowLostFocusEvent>(GEOGL_BIND_EVENT_FN(Application::onWindowLostFocus));
         dispatcher.dispatch<KeyPressedEvent>(GEOGL_BIND_EVENT_FN(Application::onKeyPressedEvent));
 
         if(event.Handled)
@@ -190,6 +262,20 @@ namespace GEOGL{
         return true;
     }
 
+    bool Application::onWindowFocus(WindowFocusEvent& event){
+
+        m_Focused = true;
+        return false;
+
+    }
+
+    bool Application::onWindowLostFocus(WindowLostFocusEvent& event){
+
+        m_Focused = false;
+        return false;
+
+    }
+
     bool Application::onKeyPressedEvent(KeyPressedEvent& event){
 
         if(
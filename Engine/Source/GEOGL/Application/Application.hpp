@@ -37,11 +37,28 @@
 #include "../Rendering/VertexArray.hpp"
 #include "../Rendering/RendererAPI.hpp"
 #include "../Rendering/Camera.hpp"
+#include "../Rendering/Renderer2D.hpp"
 #include <GEOGL/Utils.hpp>
 
 
 namespace GEOGL{
 
+    /**
+     * \brief Selects when the Application draws a frame.
+     */
+    enum class LoopMode{
+        /**
+         * Draws frames back to back, as fast as vsync allows.
+         */
+        CONTINUOUS = 0,
+
+        /**
+         * Sleeps until input arrives or a redraw is requested with Application::requestRedraw, so an idle application
+         * uses next to no CPU or GPU. For tools and other applications that only change in response to input.
+         */
+        ON_DEMAND
+    };
+
     struct ApplicationProperties{
 
         ApplicationProperties(
@@ -68,6 +85,37 @@ namespace GEOGL{
         unsigned int appVersionMinor = 0;
         unsigned int appVersionPatch = 1;
 
+        /**
+         * \brief How the Renderer2D submits quads and sizes its batches. Set this before constructing the Application.
+         * MaxQuads, MaxTextureSlots, AdaptiveBatchSize, TextureBinding and VertexFormat in the "Renderer2D" section of
+         * settings.json override it.
+         */
+        Renderer2D::BatchProperties renderer2DBatchProperties;
+
+        /**
+         * \brief When the Application draws frames. LoopMode and UnfocusedFrameRate in the "Application" section of
+         * settings.json override it and unfocusedFrameRate.
+         */
+        LoopMode loopMode = LoopMode::CONTINUOUS;
+
+        /**
+         * \brief The most frames a second drawn while the window does not have focus, or 0 for no limit.
+         */
+        uint32_t unfocusedFrameRate = 15;
+
+        /**
+         * \brief Whether the graphics API runs on a render thread of its own, which replays each frame while the next
+         * is simulated. RenderThread and FramesInFlight in the "Application" section of settings.json override it and
+         * framesInFlight.
+         */
+        bool renderThread = false;
+
+        /**
+         * \brief The frames the render thread may fall behind by, 2 or 3. More frames overlap more work, at the cost of
+         * a frame of latency each.
+         */
+        uint32_t framesInFlight = 2;
+
     };
 
     /**
@@ -117,8 +165,21 @@ namespace GEOGL{
          */
         inline void setRunning(bool running){m_Running = running; };
 
+        /**
+         * \brief Asks for frames to be drawn in LoopMode::ON_DEMAND. A layer that is animating calls this every
+         * frame, while anything else calls it once whenever what it draws changes. Safe to call from any thread.
+         * @param frames The number of frames to draw
+         */
+        void requestRedraw(uint32_t frames = 1);
+
+        inline void setLoopMode(LoopMode loopMode) { m_LoopMode = loopMode; requestRedraw(); };
+        [[nodiscard]] inline LoopMode getLoopMode() const { return m_LoopMode; };
+        [[nodiscard]] inline bool isFocused() const { return m_Focused; };
+
     private:
         bool onWindowClose(WindowCloseEvent& event);
+        bool onWindowFocus(WindowFocusEvent& event);
+        bool onWindowLostFocus(WindowLostFocusEvent& event);
 
         bool onKeyPressedEvent(KeyPressedEvent& event);
         bool onWindowResize(WindowResizeEvent& event);
@@ -131,6 +192,11 @@ namespace GEOGL{
         ImGuiLayer* m_ImGuiLayer;
         bool m_ShouldRestart = false;
 
+        LoopMode m_LoopMode = LoopMode::CONTINUOUS;
+        uint32_t m_UnfocusedFrameRate = 0;
+        bool m_Focused = true;
+        std::atomic<uint32_t> m_RedrawFrames{1};
+
     private:
         float m_LastFrameTime = 0.0f;
 
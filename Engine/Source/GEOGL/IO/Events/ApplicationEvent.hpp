@@ -85,6 +85,28 @@ namespace GEOGL{
         EVENT_CLASS_CATEGORY(EventCategoryApplication)
     };
 
+    /**
+     * Represents the window gaining input focus
+     */
+    class WindowFocusEvent : public Event{
+    public:
+        WindowFocusEvent() = default;
+
+        EVENT_CLASS_TYPE(WindowFocus)
+        EVENT_CLASS_CATEGORY(EventCategoryApplication)
+    };
+
+    /**
+     * Represents the window losing input focus
+     */
+    class WindowLostFocusEvent : public Event{
+    public:
+        WindowLostFocusEvent() = default;
+
+        EVENT_CLASS_TYPE(WindowLostFocus)
+        EVENT_CLASS_CATEGORY(EventCategoryApplication)
+    };
+
     /**
      * Represnets a tick
      */
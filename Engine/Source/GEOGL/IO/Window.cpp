@@ -28,7 +28,13 @@
 
 #if (GEOGL_BUILD_WITH_GLFW == 1)
 #include <GEOGL/Platform/GLFW.hpp>
-#else
+#endif
+
+#if (GEOGL_BUILD_WITH_NULL == 1)
+#include <GEOGL/Platform/Null.hpp>
+#endif
+
+#if (GEOGL_BUILD_WITH_GLFW != 1) && (GEOGL_BUILD_WITH_NULL != 1)
 #error No windowing LIB found
 #endif
 
@@ -39,12 +45,19 @@ namespace GEOGL{
 
         switch(Renderer::getRendererAPI()->getWindowingAPI()){
             case RendererAPI::WINDOWING_GLFW_DESKTOP:
-                if(GEOGL_BUILD_WITH_GLFW) {
-                    return new GEOGL::Platform::GLFW::Window(props);
-                }else{
-                    GEOGL_CORE_ASSERT_NOSTRIP(false, "GLFW is not supported. Exiting.");
-                    exit(-1);
-                }
+#if (GEOGL_BUILD_WITH_GLFW == 1)
+                return new GEOGL::Platform::GLFW::Window(props);
+#else
+                GEOGL_CORE_ASSERT_NOSTRIP(false, "GLFW is not supported. Exiting.");
+                exit(-1);
+#endif
+            case RendererAPI::WINDOWING_NULL:
+#if (GEOGL_BUILD_WITH_NULL == 1)
+                return new GEOGL::Platform::Null::Window(props);
+#else
+                GEOGL_CORE_ASSERT_NOSTRIP(false, "The Null window is not supported. Exiting.");
+                exit(-1);
+#endif
             default:
                 GEOGL_CORE_ASSERT_NOSTRIP(false, "No api is selected. Exiting.");
         }
@@ -33,6 +33,7 @@
 
 #include "../IO/Events/Event.hpp"
 #include "../Rendering/RendererAPI.hpp"
+#include "../Rendering/GraphicsContext.hpp"
 #include <GEOGL/Utils.hpp>
 
 namespace GEOGL {
@@ -106,8 +107,23 @@ namespace GEOGL {
 
         Window(){};
         virtual ~Window() {}
+
+        /**
+         * \brief Dispatches the pending events, then presents the frame.
+         */
         virtual void onUpdate() = 0;
 
+        /**
+         * \brief Blocks until an event arrives or the timeout passes, then dispatches the pending events.
+         * @param timeout The longest time to wait, in seconds
+         */
+        virtual void waitEvents(float timeout) = 0;
+
+        /**
+         * \brief Wakes a thread blocked in waitEvents. Safe to call from any thread.
+         */
+        virtual void postEmptyEvent() = 0;
+
         /**
          * Gets the current Width of the window.
          * @return The current width of the window
@@ -137,6 +153,12 @@ namespace GEOGL {
          */
         virtual void* getNativeWindow() const = 0;
 
+        /**
+         * Gets the graphics context the window presents with, so the render thread can take it over.
+         * @return The graphics context, or nullptr if the window has none
+         */
+        virtual GraphicsContext* getGraphicsContext() const = 0;
+
 
         /**
          * Queries the window type.
@@ -34,11 +34,59 @@
 #include <ImGui/imgui.h>
 #include <GLFW/glfw3.h>
 #include "../Application/Application.hpp"
+#include "../Rendering/RenderThread.hpp"
 #include "../../Platform/OpenGL/ImGuiImpl/imgui_impl_glfw.h"
 #include "../../Platform/OpenGL/ImGuiImpl/imgui_impl_opengl3.h"
 
 namespace GEOGL{
 
+    /**
+     * \brief A copy of a frame's draw data, since ImGui rebuilds the original while the render thread draws it.
+     */
+    struct DrawDataCopy{
+        ImDrawData drawData;
+        std::vector<std::unique_ptr<ImDrawList>> drawLists;
+        std::vector<ImDrawList*> cmdLists;
+    };
+
+    /* Every frame in flight renders from a copy of its own, and the frame being recorded needs one more */
+    static std::vector<DrawDataCopy> s_DrawDataCopies;
+    static size_t s_NextDrawDataCopy = 0;
+
+    static ImDrawData* copyDrawData(const ImDrawData* source){
+        GEOGL_PROFILE_FUNCTION();
+
+        s_DrawDataCopies.resize(RenderThread::getFramesInFlight() + 1);
+        DrawDataCopy& copy = s_DrawDataCopies[s_NextDrawDataCopy];
+        s_NextDrawDataCopy = (s_NextDrawDataCopy + 1) % s_DrawDataCopies.size();
+
+        /* Resizing keeps the buffers of earlier frames, so a steady UI copies without allocating */
+        copy.drawData = *source;
+        while(copy.drawLists.size() < (size_t) source->CmdListsCount){
+            copy.drawLists.push_back(std::make_unique<ImDrawList>(nullptr));
+        }
+        copy.cmdLists.resize(source->CmdListsCount);
+
+        for(int i = 0; i < source->CmdListsCount; ++i){
+            const ImDrawList* sourceList = source->CmdLists[i];
+            ImDrawList* list = copy.drawLists[i].get();
+
+            list->CmdBuffer.resize(sourceList->CmdBuffer.Size);
+            memcpy(list->CmdBuffer.Data, sourceList->CmdBuffer.Data, sourceList->CmdBuffer.size_in_bytes());
+            list->IdxBuffer.resize(sourceList->IdxBuffer.Size);
+            memcpy(list->IdxBuffer.Data, sourceList->IdxBuffer.Data, sourceList->IdxBuffer.size_in_bytes());
+            list->VtxBuffer.resize(sourceList->VtxBuffer.Size);
+            memcpy(list->VtxBuffer.Data, sourceList->VtxBuffer.Data, sourceList->VtxBuffer.size_in_bytes());
+            list->Flags = sourceList->Flags;
+
+            copy.cmdLists[i] = list;
+        }
+        copy.drawData.CmdLists = copy.cmdLists.data();
+
+        return &copy.drawData;
+
+    }
+
 
     ImGuiLayer::ImGuiLayer()
     : Layer("ImGui Layer"){
@@ -58,10 +106,17 @@ namespace GEOGL{
         IMGUI_CHECKVERSION();
         ImGui::CreateContext();
         ImGuiIO& io = ImGui::GetIO(); (void)io;
+
+        /* A Null window has nothing to draw ImGui to, so layers still build their UI, but it is never rendered */
+        Application& app = Application::get();
+        m_Headless = app.getWindow().type() == RendererAPI::WINDOWING_NULL;
+
         io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;       // Enable Keyboard Controls
         //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
         io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;           // Enable Docking
-        io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;         // Enable Multi-Viewport / Platform Windows
+        /* Platform windows are created and presented on the main thread, so they cannot be used with a render thread */
+        if(!m_Headless && !RenderThread::isEnabled())
+            io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;     // Enable Multi-Viewport / Platform Windows
         //io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoTaskBarIcons;
         //io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoMerge;
         io.ConfigFlags |= ImGuiConfigFlags_DpiEnableScaleFonts;
@@ -78,13 +133,25 @@ namespace GEOGL{
             style.Colors[ImGuiCol_WindowBg].w = 1.0f;
         }
 
-        Application& app = Application::get();
+        if(m_Headless){
+            unsigned char* pixels;
+            int width, height;
+            io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+            m_Time = app.getWindow().getCurrentPlatformTime();
+            GEOGL_CORE_INFO("Attached headless ImGui layer.");
+            return;
+        }
+
         auto* window = static_cast<GLFWwindow*>(app.getWindow().getNativeWindow());
 
         // Setup Platform/Renderer bindings
         ImGui_ImplGlfw_InitForOpenGL(window, true);
         ImGui_ImplOpenGL3_Init("#version 410");
 
+        /* Create the font texture and shaders now, so that NewFrame never has to on the render thread */
+        if(RenderThread::isEnabled())
+            ImGui_ImplOpenGL3_CreateDeviceObjects();
+
         GEOGL_CORE_INFO("Attached ImGui layer.");
 
     }
@@ -92,8 +159,11 @@ namespace GEOGL{
     void ImGuiLayer::onDetach() {
         GEOGL_PROFILE_FUNCTION();
 
-        ImGui_ImplOpenGL3_Shutdown();
-        ImGui_ImplGlfw_Shutdown();
+        if(!m_Headless){
+            ImGui_ImplOpenGL3_Shutdown();
+            ImGui_ImplGlfw_Shutdown();
+        }
+        s_DrawDataCopies.clear();
         ImGui::DestroyContext();
 
     }
@@ -101,8 +171,20 @@ namespace GEOGL{
     void ImGuiLayer::begin(){
         GEOGL_PROFILE_FUNCTION();
 
-        ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
+        if(m_Headless){
+            /* Without a platform backend, the display size and time step have to be supplied here */
+            ImGuiIO& io = ImGui::GetIO();
+            Window& window = Application::get().getWindow();
+            io.DisplaySize = ImVec2(static_cast<float>(window.getWidth()), static_cast<float>(window.getHeight()));
+
+            float time = window.getCurrentPlatformTime();
+            io.DeltaTime = std::max(time - m_Time, 1.0f / 1000.0f);
+            m_Time = time;
+        }else{
+            if(!RenderThread::isRunning())
+                ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplGlfw_NewFrame();
+        }
         ImGui::NewFrame();
 
     }
@@ -116,7 +198,17 @@ namespace GEOGL{
 
         // rendering
         ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        if(m_Headless)
+            return;
+
+        if(RenderThread::isRunning()){
+            ImDrawData* drawData = copyDrawData(ImGui::GetDrawData());
+            RenderThread::submit([drawData](){
+                ImGui_ImplOpenGL3_RenderDrawData(drawData);
+            });
+        }else{
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        }
 
         if(io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable){
             GLFWwindow* backup_current_context = glfwGetCurrentContext();
@@ -60,6 +60,7 @@ namespace GEOGL{
 
     private:
         float m_Time = 0;
+        bool m_Headless = false;
 
     };
 
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include "CachedLayer.hpp"
+#include "../Application/Application.hpp"
+#include "../Rendering/Renderer2D.hpp"
+
+namespace GEOGL {
+
+    CachedLayer::CachedLayer(const std::string& name) :
+        Layer(name), m_CompositeCamera({-1.0f, 1.0f, -1.0f, 1.0f}){
+
+    }
+
+    void CachedLayer::onUpdate(TimeStep timeStep) {
+        GEOGL_PROFILE_FUNCTION();
+
+        onCachedUpdate(timeStep);
+
+        glm::ivec2 dimensions = Application::get().getWindow().getDimensions();
+        if(!m_RenderCache)
+            m_RenderCache = createScope<RenderCache>((uint32_t)dimensions.x, (uint32_t)dimensions.y);
+        else
+            m_RenderCache->resize((uint32_t)dimensions.x, (uint32_t)dimensions.y);
+
+        m_RenderCache->update([this](){ onRenderCache(); });
+
+        Renderer2D::beginScene(m_CompositeCamera);
+        Renderer2D::drawQuad({{0.0f, 0.0f, 0.0f}, {2.0f, 2.0f}}, m_RenderCache->getTexture());
+        Renderer2D::endScene();
+
+    }
+
+}
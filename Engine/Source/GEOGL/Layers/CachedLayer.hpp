@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#ifndef GEOGL_CACHEDLAYER_HPP
+#define GEOGL_CACHEDLAYER_HPP
+
+#include "Layer.hpp"
+#include "../Rendering/RenderCache.hpp"
+#include "../Rendering/Camera.hpp"
+
+namespace GEOGL {
+
+    /**
+     * \brief A Layer that renders into a RenderCache the size of the window, and is otherwise drawn as a single quad
+     * over the layers below it.
+     *
+     * Override onRenderCache to draw the layer, and call invalidateCache whenever what it draws changes, for example
+     * from onEvent or onCachedUpdate. A resize of the window invalidates the cache as well.
+     */
+    class GEOGL_API CachedLayer : public Layer{
+    public:
+        explicit CachedLayer(const std::string& name = "Cached Layer");
+
+        /**
+         * \brief Calls onCachedUpdate, renders the cache if it is dirty, and draws it.
+         */
+        void onUpdate(TimeStep timeStep) final;
+
+        inline void invalidateCache() { if(m_RenderCache) m_RenderCache->invalidate(); };
+
+    protected:
+        /**
+         * \brief Called every frame before the cache is checked, to update the layer and invalidate the cache.
+         */
+        virtual void onCachedUpdate(TimeStep timeStep){}
+
+        /**
+         * \brief Renders the layer into the cache. Only called while the cache is dirty.
+         */
+        virtual void onRenderCache() = 0;
+
+    private:
+        Scope<RenderCache> m_RenderCache;
+
+        /* Maps the cache onto the whole viewport */
+        OrthographicCamera m_CompositeCamera;
+    };
+
+}
+
+#endif //GEOGL_CACHEDLAYER_HPP
@@ -34,39 +34,13 @@
 #include "../../Platform/OpenGL/Rendering/OpenGLBuffer.hpp"
 #endif
 
-namespace GEOGL{
+#if GEOGL_BUILD_WITH_NULL == 1
+#include "../../Platform/Null/Rendering/NullBuffer.hpp"
+#endif
 
+namespace GEOGL{
 
 
-    uint32_t BufferElement::getComponentCount() const{
-        switch(dataType){
-            case ShaderDataType::FLOAT:
-                return 1;
-            case ShaderDataType::FLOAT2:
-                return 2;
-            case ShaderDataType::FLOAT3:
-                return 3;
-            case ShaderDataType::FLOAT4:
-                return 4;
-            case ShaderDataType::MAT3:
-                return 3*3;
-            case ShaderDataType::MAT4:
-                return 4*4;
-            case ShaderDataType::INT:
-                return 1;
-            case ShaderDataType::INT2:
-                return 2;
-            case ShaderDataType::INT3:
-                return 3;
-            case ShaderDataType::INT4:
-                return 4;
-            case ShaderDataType::BOOLEAN:
-                return 1;
-            default:
-            GEOGL_CORE_ASSERT(false, "Unknown shader DataType");
-                return 0;
-        }
-    }
 
     void BufferLayout::calculateOffsetAndStride(){
         GEOGL_PROFILE_FUNCTION();
@@ -93,6 +67,13 @@ namespace GEOGL{
                 return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::VertexBuffer>(size);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} Vertex Buffer. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
@@ -113,6 +94,13 @@ namespace GEOGL{
                 return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::VertexBuffer>(vertices, size);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} Vertex Buffer. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
@@ -121,6 +109,31 @@ namespace GEOGL{
 
     }
 
+    Ref<StreamVertexBuffer> StreamVertexBuffer::create(uint32_t regionSize, uint32_t regionCount) {
+        GEOGL_PROFILE_FUNCTION();
+
+        const auto renderer = Renderer::getRendererAPI();
+
+        switch(renderer->getRenderingAPI()){
+            case RendererAPI::RENDERING_OPENGL_DESKTOP:
+#if GEOGL_BUILD_WITH_OPENGL == 1
+                return createRef<GEOGL::Platform::OpenGL::StreamVertexBuffer>(regionSize, regionCount);
+#else
+                GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                return createRef<GEOGL::Platform::Null::StreamVertexBuffer>(regionSize, regionCount);
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
+#endif
+            default:
+                GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} Stream Vertex Buffer. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
+                return nullptr;
+        }
+
+    }
+
     Ref<IndexBuffer> IndexBuffer::create(uint32_t* indices, uint32_t count) {
         GEOGL_PROFILE_FUNCTION();
 
@@ -129,15 +142,73 @@ namespace GEOGL{
         Ref<IndexBuffer> result;
         switch(renderer->getRenderingAPI()){
             case RendererAPI::RENDERING_OPENGL_DESKTOP:
-#ifdef GEOGL_BUILD_WITH_OPENGL
+#if GEOGL_BUILD_WITH_OPENGL == 1
                 result.reset(new GEOGL::Platform::OpenGL::IndexBuffer(indices, count));
                 return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::IndexBuffer>(indices, count);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} shader. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
                 return nullptr;
         }
     }
+
+    Ref<UniformBuffer> UniformBuffer::create(uint32_t size, uint32_t binding) {
+        GEOGL_PROFILE_FUNCTION();
+
+        const auto renderer = Renderer::getRendererAPI();
+
+        switch(renderer->getRenderingAPI()){
+            case RendererAPI::RENDERING_OPENGL_DESKTOP:
+#if GEOGL_BUILD_WITH_OPENGL == 1
+                return createRef<GEOGL::Platform::OpenGL::UniformBuffer>(size, binding);
+#else
+                GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                return createRef<GEOGL::Platform::Null::UniformBuffer>(size, binding);
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
+#endif
+            default:
+                GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} Uniform Buffer. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
+                return nullptr;
+        }
+
+    }
+
+    UniformBufferRing::UniformBufferRing(uint32_t blockSize, uint32_t slotCount, uint32_t binding)
+        : m_BlockSize(blockSize), m_SlotCount(std::max(slotCount, 1u)) {
+        GEOGL_PROFILE_FUNCTION();
+
+        /* Every slot starts at an offset glBindBufferRange accepts */
+        uint32_t alignment = std::max(RenderCommand::getCapabilities().uniformBufferOffsetAlignment, 1u);
+        m_Stride = (blockSize + alignment - 1) / alignment * alignment;
+        m_Buffer = UniformBuffer::create(m_Stride * m_SlotCount, binding);
+
+    }
+
+    uint32_t UniformBufferRing::push(const void* data) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        if(m_NextSlot == m_SlotCount){
+            m_Buffer->invalidate();
+            m_NextSlot = 0;
+        }
+
+        uint32_t offset = m_NextSlot++ * m_Stride;
+        m_Buffer->setData(data, m_BlockSize, offset);
+        m_Buffer->bindRange(offset, m_BlockSize);
+        return offset;
+
+    }
 }
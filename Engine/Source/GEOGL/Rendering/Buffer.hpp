@@ -42,22 +42,22 @@ namespace GEOGL{
         /**
          * \brief The ShaderDataType representing the type of data (e.g. vec3, mat4x4, int, etc.)
          */
-        ShaderDataType dataType;
+        ShaderDataType dataType = ShaderDataType::NONE;
 
         /**
          * \brief The offset of this particular element from the beginning of the layout
          */
-        uint32_t offset;
+        uint32_t offset = 0;
 
         /**
          * \brief The size (in bytes) of this element
          */
-        uint32_t size;
+        uint32_t size = 0;
 
         /**
          * \brief Whether or not the data is normalized. Defaults to false.
          */
-        bool normalized;
+        bool normalized = false;
 
         /**
          * Defines a default constructor
@@ -71,11 +71,125 @@ namespace GEOGL{
          * @param normalized Whether or not the data is normalized.
          */
         inline BufferElement(ShaderDataType dataType, const std::string& name, bool normalized = false)
-            : name(name), dataType(dataType) , size(shaderDataTypeSize(dataType)), offset(0), normalized(normalized){};
+            : name(name), dataType(dataType), offset(0), size(shaderDataTypeSize(dataType)), normalized(normalized){};
+
+        /**
+         * \brief Constructs a BufferElement at a known offset, as the vertex struct layouts do.
+         */
+        inline BufferElement(ShaderDataType dataType, const std::string& name, uint32_t offset, bool normalized)
+            : name(name), dataType(dataType), offset(offset), size(shaderDataTypeSize(dataType)), normalized(normalized){};
+
+        inline uint32_t getComponentCount() const{
+            switch(dataType){
+                case ShaderDataType::FLOAT:
+                    return 1;
+                case ShaderDataType::FLOAT2:
+                    return 2;
+                case ShaderDataType::FLOAT3:
+                    return 3;
+                case ShaderDataType::FLOAT4:
+                    return 4;
+                case ShaderDataType::MAT3:
+                    return 3*3;
+                case ShaderDataType::MAT4:
+                    return 4*4;
+                case ShaderDataType::INT:
+                    return 1;
+                case ShaderDataType::INT2:
+                    return 2;
+                case ShaderDataType::INT3:
+                    return 3;
+                case ShaderDataType::INT4:
+                    return 4;
+                case ShaderDataType::BOOLEAN:
+                    return 1;
+                case ShaderDataType::UINT:
+                    return 1;
+                case ShaderDataType::UBYTE4:
+                    return 4;
+                case ShaderDataType::USHORT:
+                    return 1;
+                case ShaderDataType::USHORT2:
+                    return 2;
+                case ShaderDataType::HALF:
+                    return 1;
+                default:
+                    return 0;
+            }
+        }
+    };
+
+    /**
+     * \brief An element of a StaticBufferLayout. The name is not copied, so it must outlive the layout, as literals do.
+     * It is copied into a BufferElement once the layout is set on a buffer.
+     */
+    struct StaticBufferElement{
+        const char* name;
+        ShaderDataType dataType;
+        uint32_t offset;
+        bool normalized;
+    };
 
-        uint32_t getComponentCount() const;
+    /**
+     * \brief A BufferLayout derived from a vertex struct at compile time, built by makeBufferLayout.
+     */
+    template<size_t N>
+    struct StaticBufferLayout{
+        std::array<StaticBufferElement, N> elements;
+        uint32_t stride;
+        uint32_t instanceDivisor;
     };
 
+    /**
+     * \brief Builds the element of a vertex struct member, checking that it lies inside of the struct.
+     * \note The check throws, which fails to compile when the layout is constexpr, as it should be.
+     */
+    template<typename Vertex>
+    constexpr StaticBufferElement makeVertexElement(ShaderDataType dataType, const char* name, size_t offset, bool normalized){
+
+        if(shaderDataTypeSize(dataType) == 0 || offset + shaderDataTypeSize(dataType) > sizeof(Vertex))
+            throw std::logic_error("The vertex element does not fit in the vertex");
+
+        return {name, dataType, (uint32_t) offset, normalized};
+
+    }
+
+    /**
+     * \brief Derives a layout from a vertex struct, with the offsets of its members and the size of the struct as the
+     * stride, so padding inside of the struct is accounted for.
+     *
+     * Usage:
+     * \code
+     * static constexpr auto s_VertexLayout = GEOGL::makeBufferLayout<Vertex>(
+     *         GEOGL_VERTEX_ELEMENT(Vertex, position, "a_Position"),
+     *         GEOGL_VERTEX_ELEMENT_AS(Vertex, color, GEOGL::ShaderDataType::UBYTE4, "a_Color", true));
+     * vertexBuffer->setLayout(s_VertexLayout);
+     * \endcode
+     *
+     * @tparam Vertex The vertex struct
+     * @tparam InstanceDivisor How many instances are drawn before advancing to the next vertex, or 0 for per vertex data
+     */
+    template<typename Vertex, uint32_t InstanceDivisor = 0, typename... Elements>
+    constexpr StaticBufferLayout<sizeof...(Elements)> makeBufferLayout(Elements... elements){
+
+        static_assert(std::is_standard_layout_v<Vertex>, "The offsets of a vertex struct are only defined for standard layout types");
+        return {{elements...}, (uint32_t) sizeof(Vertex), InstanceDivisor};
+
+    }
+
+/**
+ * \brief Names a member of a vertex struct as an element, with the ShaderDataType of its type.
+ */
+#define GEOGL_VERTEX_ELEMENT(Vertex, member, name) \
+    ::GEOGL::makeVertexElement<Vertex>(::GEOGL::ShaderDataTypeOf<std::remove_cv_t<decltype(std::declval<Vertex>().member)>>::value, name, offsetof(Vertex, member), false)
+
+/**
+ * \brief Names a member of a vertex struct as an element of another ShaderDataType, for data packed into it. The
+ * element may span the members that follow.
+ */
+#define GEOGL_VERTEX_ELEMENT_AS(Vertex, member, dataType, name, normalized) \
+    ::GEOGL::makeVertexElement<Vertex>(dataType, name, offsetof(Vertex, member), normalized)
+
     /**
      * \brief Defines a BufferLayout to be used in a VertexBuffer to define how the components are packed.
      */
@@ -100,19 +214,41 @@ namespace GEOGL{
          * })
          *
          * @param elements An initializer_list of elements to use to initialize the vector with.
+         * @param instanceDivisor How many instances to draw before advancing to the next element in the buffer. 0,
+         * the default, advances every vertex instead.
          */
-        inline BufferLayout(const std::initializer_list<BufferElement>& elements) : m_Elements(elements) {
+        inline BufferLayout(const std::initializer_list<BufferElement>& elements, uint32_t instanceDivisor = 0) : m_Elements(elements), m_InstanceDivisor(instanceDivisor) {
 
             calculateOffsetAndStride();
 
         };
 
+        /**
+         * \brief Constructs a BufferLayout from one derived from a vertex struct, keeping its offsets and stride.
+         * @param layout The layout built by makeBufferLayout
+         */
+        template<size_t N>
+        inline BufferLayout(const StaticBufferLayout<N>& layout) // NOLINT(google-explicit-constructor)
+            : m_Stride(layout.stride), m_InstanceDivisor(layout.instanceDivisor) {
+
+            m_Elements.reserve(N);
+            for(const StaticBufferElement& element : layout.elements)
+                m_Elements.emplace_back(element.dataType, element.name, element.offset, element.normalized);
+
+        };
+
         /**
          * \brief Gets the stride of the data. I.E. how big in size all of the elements put together are.
          * @return The Stride of the data.
          */
         inline uint32_t getStride() const { return m_Stride; };
 
+        /**
+         * \brief Gets how many instances are drawn before advancing to the next element, or 0 if the data is per vertex.
+         * @return The instance divisor of the data.
+         */
+        inline uint32_t getInstanceDivisor() const { return m_InstanceDivisor; };
+
         /**
          * \brief Gets the vector of elements used in the VertexBuffer
          * @return The vector of BufferElement s
@@ -159,6 +295,11 @@ namespace GEOGL{
          */
         uint32_t m_Stride;
 
+        /**
+         * \brief Stores the instance divisor of all of the elements
+         */
+        uint32_t m_InstanceDivisor = 0;
+
     };
 
     /**
@@ -209,6 +350,11 @@ namespace GEOGL{
          */
         virtual const BufferLayout& getLayout() const = 0;
 
+        /**
+         * \brief Gets the name of the buffer in the rendering API.
+         */
+        [[nodiscard]] virtual uint32_t getRendererID() const = 0;
+
         /**
          * \brief Creates an empty Vertex Buffer
          * @param size The size of the vertex buffer to create, in bytes
@@ -227,6 +373,72 @@ namespace GEOGL{
     };
 
 
+    /**
+     * \brief Describes a VertexBuffer that is rewritten every batch, split into regions the CPU writes to directly.
+     *
+     * Usage, once per batch:
+     * \code
+     * auto* vertices = (Vertex*)streamBuffer->getWritePointer();
+     * // write up to getRegionSize() bytes of vertices
+     * uint32_t offset = streamBuffer->commit(bytesWritten);
+     * // draw, using offset / sizeof(Vertex) as the base vertex
+     * streamBuffer->advance();
+     * \endcode
+     * and once every batch of the frame has been drawn:
+     * \code
+     * streamBuffer->endFrame();
+     * \endcode
+     *
+     * Implementations are free to hand out memory mapped directly from the GPU. The regions then form a ring, and the
+     * GPU is fenced once per frame rather than once per batch. advance() only waits when the region about to be reused
+     * belongs to a frame the GPU has not finished drawing yet.
+     */
+    class GEOGL_API StreamVertexBuffer : public VertexBuffer{
+    public:
+        virtual ~StreamVertexBuffer(){};
+
+        /**
+         * \brief Gets the memory the next batch should be written to. getRegionSize() bytes are available.
+         * @return The pointer to write the batch to.
+         */
+        virtual void* getWritePointer() = 0;
+
+        /**
+         * \brief Gets the number of bytes that can be written to each region
+         * @return The size of a region, in bytes
+         */
+        virtual uint32_t getRegionSize() const = 0;
+
+        /**
+         * \brief Makes size bytes written to getWritePointer() available for drawing.
+         * @param size The number of bytes written
+         * @return The offset, in bytes, of the written data from the start of the buffer.
+         */
+        virtual uint32_t commit(uint32_t size) = 0;
+
+        /**
+         * \brief Moves on to the next region once the draws reading the committed data have been issued.
+         */
+        virtual void advance() = 0;
+
+        /**
+         * \brief Marks every region written since the last call as belonging to one frame, which is reused as a
+         * whole once the GPU has drawn it.
+         */
+        virtual void endFrame() = 0;
+
+        /**
+         * \brief Creates a StreamVertexBuffer using the API stored in the Application singleton.
+         * @param regionSize The size of each region, in bytes. Should be a multiple of the vertex stride.
+         * @param regionCount The number of regions in the ring. Several frames worth of batches keeps advance() from
+         * waiting on the frame still being drawn.
+         * @return The StreamVertexBuffer object using the selected API.
+         */
+        static Ref<StreamVertexBuffer> create(uint32_t regionSize, uint32_t regionCount = 3);
+
+    };
+
+
     /**
      * \brief Describes an index buffer interface.
      */
@@ -255,6 +467,11 @@ namespace GEOGL{
          */
         virtual uint32_t getCount() const = 0;
 
+        /**
+         * \brief Gets the name of the buffer in the rendering API.
+         */
+        [[nodiscard]] virtual uint32_t getRendererID() const = 0;
+
         /**
          * \brief Creates a IndexBuffer using the API stored in the Application singleton.
          * @param indices The data to upload to the GPU
@@ -265,6 +482,89 @@ namespace GEOGL{
 
     };
 
+    /**
+     * \brief Describes a buffer of uniform block data, shared by every shader that declares the block.
+     *
+     * Shaders name their blocks, and Shader::setUniformBlockBinding maps each name to a binding point, so data written
+     * here once is seen by every shader without being uploaded to each of them. The data must follow the std140 layout
+     * the blocks are declared with.
+     */
+    class GEOGL_API UniformBuffer{
+    public:
+        virtual ~UniformBuffer(){};
+
+        /**
+         * \brief Writes data into the buffer.
+         * @param data The data to write
+         * @param size The number of bytes to write
+         * @param offset Where in the buffer to write to, in bytes
+         */
+        virtual void setData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+        /**
+         * \brief Discards the contents of the buffer, so writes after this do not wait on draws still reading it.
+         */
+        virtual void invalidate() = 0;
+
+        /**
+         * \brief Binds the whole buffer to its binding point
+         */
+        virtual void bind() const = 0;
+
+        /**
+         * \brief Binds part of the buffer to its binding point.
+         * @param offset The start of the part, in bytes. Must be a multiple of RenderCaps::uniformBufferOffsetAlignment
+         * @param size The size of the part, in bytes
+         */
+        virtual void bindRange(uint32_t offset, uint32_t size) const = 0;
+
+        virtual uint32_t getSize() const = 0;
+        virtual uint32_t getBinding() const = 0;
+
+        /**
+         * \brief Creates a UniformBuffer using the API stored in the Application singleton.
+         * @param size The size of the buffer, in bytes
+         * @param binding The binding point the buffer is bound to
+         * @return The UniformBuffer object using the selected API.
+         */
+        static Ref<UniformBuffer> create(uint32_t size, uint32_t binding);
+
+    };
+
+    /**
+     * \brief A UniformBuffer split into slots, each holding one copy of a block, written in turn.
+     *
+     * Every push writes the next slot and binds just its range, so a block can change between draws without waiting
+     * for earlier draws to finish reading it. Slots start at multiples of RenderCaps::uniformBufferOffsetAlignment, and
+     * the buffer is invalidated whenever the ring wraps around to its first slot.
+     */
+    class GEOGL_API UniformBufferRing{
+    public:
+        /**
+         * \brief Creates a ring of slotCount slots of blockSize bytes, bound to binding.
+         */
+        UniformBufferRing(uint32_t blockSize, uint32_t slotCount, uint32_t binding);
+
+        /**
+         * \brief Writes a block to the next slot and binds it.
+         * @param data The block, blockSize bytes long
+         * @return The offset of the slot the block was written to, in bytes
+         */
+        uint32_t push(const void* data);
+
+        [[nodiscard]] inline uint32_t getBlockSize() const { return m_BlockSize; };
+        [[nodiscard]] inline uint32_t getStride() const { return m_Stride; };
+        [[nodiscard]] inline uint32_t getSlotCount() const { return m_SlotCount; };
+        [[nodiscard]] inline const Ref<UniformBuffer>& getBuffer() const { return m_Buffer; };
+
+    private:
+        Ref<UniformBuffer> m_Buffer;
+        uint32_t m_BlockSize;
+        uint32_t m_Stride;
+        uint32_t m_SlotCount;
+        uint32_t m_NextSlot = 0;
+    };
+
 }
 
 #endif //GEOGL_BUFFER_HPP
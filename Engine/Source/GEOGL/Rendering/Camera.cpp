@@ -104,6 +104,30 @@ namespace GEOGL{
 
     }
 
+    OrthographicCamera::ProjectionBounds OrthographicCamera::calculateWorldBounds() const {
+
+        float sinRotation = std::sin(glm::radians(m_RotationZ));
+        float cosRotation = std::cos(glm::radians(m_RotationZ));
+
+        /* Rotate the center of the projection bounds into the world, then fit a box around the rotated extents */
+        glm::vec2 center = {(m_OrthographicBounds.left + m_OrthographicBounds.right) * 0.5f, (m_OrthographicBounds.bottom + m_OrthographicBounds.top) * 0.5f};
+        glm::vec2 halfSize = {m_OrthographicBounds.getWidth() * 0.5f, m_OrthographicBounds.getHeight() * 0.5f};
+
+        glm::vec2 worldCenter = {m_Position.x + cosRotation * center.x - sinRotation * center.y,
+                                 m_Position.y + sinRotation * center.x + cosRotation * center.y};
+        glm::vec2 halfExtents = {std::abs(cosRotation) * std::abs(halfSize.x) + std::abs(sinRotation) * std::abs(halfSize.y),
+                                 std::abs(sinRotation) * std::abs(halfSize.x) + std::abs(cosRotation) * std::abs(halfSize.y)};
+
+        ProjectionBounds worldBounds = m_OrthographicBounds;
+        worldBounds.left = worldCenter.x - halfExtents.x;
+        worldBounds.right = worldCenter.x + halfExtents.x;
+        worldBounds.bottom = worldCenter.y - halfExtents.y;
+        worldBounds.top = worldCenter.y + halfExtents.y;
+
+        return worldBounds;
+
+    }
+
     void OrthographicCamera::recalculateViewMatrix() {
         GEOGL_PROFILE_FUNCTION();
 
@@ -83,6 +83,13 @@ namespace GEOGL{
 
         static ProjectionBounds calculateBestOrthographicBounds(const glm::ivec2& windowDimensions, const glm::vec2& clipPlanes = {-1.0f, 1.0f});
 
+        /**
+         * \brief Calculates the world space, axis aligned rectangle around everything the camera can see.
+         *
+         * The projection bounds are moved by the position of the camera, and grown to fit them when rotated.
+         */
+        ProjectionBounds calculateWorldBounds() const;
+
     private:
         void recalculateViewMatrix();
     private:
@@ -30,6 +30,10 @@
 #include <GEOGL/Platform/OpenGL.hpp>
 #endif
 
+#if GEOGL_BUILD_WITH_NULL
+#include <GEOGL/Platform/Null.hpp>
+#endif
+
 namespace GEOGL{
 
 
@@ -42,6 +46,13 @@ namespace GEOGL{
 #else
             GEOGL_CORE_CRITICAL_NOSTRIP("Tried to create an OpenGL Framebuffer, but not supported");
             return nullptr;
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL
+                return createRef<GEOGL::Platform::Null::Framebuffer>(framebufferSpecification);
+#else
+            GEOGL_CORE_CRITICAL_NOSTRIP("Tried to create a Null Framebuffer, but not supported");
+            return nullptr;
 #endif
             default:
                 GEOGL_CORE_ASSERT(false, "Tried to create a framebuffer, but no supported graphics API is selected");
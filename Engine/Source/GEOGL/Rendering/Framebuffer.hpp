@@ -26,6 +26,8 @@
 #ifndef GEOGL_FRAMEBUFFER_HPP
 #define GEOGL_FRAMEBUFFER_HPP
 
+#include "Texture.hpp"
+
 namespace GEOGL{
 
     struct FramebufferSpecification{
@@ -46,6 +48,11 @@ namespace GEOGL{
 
         virtual uint32_t getColorAttachmentRendererID() const = 0;
 
+        /**
+         * \brief Gets the color attachment as a texture, so it can be drawn like any other. Replaced on resize.
+         */
+        [[nodiscard]] virtual const Ref<Texture2D>& getColorAttachment() const = 0;
+
         //virtual FramebufferSpecification& getFramebufferSpecification() = 0;
         [[nodiscard]] virtual const FramebufferSpecification& getFramebufferSpecification() const = 0;
 
@@ -75,6 +75,18 @@ namespace GEOGL{
          */
         virtual void swapBuffers() = 0;
 
+        /**
+         * \brief Makes the context current on the calling thread, so the render thread can take it over.
+         *
+         * \note Contexts that are not tied to a thread can leave this empty.
+         */
+        virtual void makeCurrent() {};
+
+        /**
+         * \brief Releases the context from the calling thread, so that another thread can make it current.
+         */
+        virtual void releaseCurrent() {};
+
     private:
 
     };
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include "QuadVertexKernel.hpp"
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#   define GEOGL_QUAD_KERNEL_AVX2 1
+#   define GEOGL_QUAD_KERNEL_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define GEOGL_QUAD_KERNEL_SSE2 1
+#endif
+
+namespace GEOGL{
+
+    /* The SIMD paths load a transform as seven consecutive floats, so make sure nobody pads the struct */
+    static_assert(sizeof(Quad2DTransform) == 7 * sizeof(float), "Quad2DTransform must be seven tightly packed floats");
+
+    /*
+     * For a quad with half extents (hx, hy), the corner (sx*hx, sy*hy) with sx, sy = +-1 rotates to
+     * sx*(cos*hx, sin*hx) + sy*(-sin*hy, cos*hy). Calling those two vectors a and b, the corners are
+     * position -a -b, position +a -b, position +a +b, and position -a +b.
+     */
+    static inline void generateCornersScalar(const Quad2DTransform& transform, uint8_t* firstVertex, size_t vertexStride){
+
+        const float hx = 0.5f * transform.size.x;
+        const float hy = 0.5f * transform.size.y;
+
+        const float ax = transform.cosRotation * hx;
+        const float ay = transform.sinRotation * hx;
+        const float bx = -transform.sinRotation * hy;
+        const float by = transform.cosRotation * hy;
+
+        const glm::vec3& position = transform.position;
+
+        *reinterpret_cast<glm::vec3*>(firstVertex)                  = {position.x - ax - bx, position.y - ay - by, position.z};
+        *reinterpret_cast<glm::vec3*>(firstVertex + vertexStride)   = {position.x + ax - bx, position.y + ay - by, position.z};
+        *reinterpret_cast<glm::vec3*>(firstVertex + vertexStride*2) = {position.x + ax + bx, position.y + ay + by, position.z};
+        *reinterpret_cast<glm::vec3*>(firstVertex + vertexStride*3) = {position.x - ax + bx, position.y - ay + by, position.z};
+
+    }
+
+#if GEOGL_QUAD_KERNEL_SSE2
+
+    /*
+     * Takes the corners of four quads in structure of arrays form (one lane per quad) and scatters them out to
+     * the strided vertex positions, two floats at a time.
+     */
+    static inline void storeCornersSSE2(__m128 c0x, __m128 c1x, __m128 c2x, __m128 c3x,
+                                        __m128 c0y, __m128 c1y, __m128 c2y, __m128 c3y,
+                                        __m128 pz, uint8_t* firstVertex, size_t vertexStride){
+
+        /* After transposing, register q holds the x (or y) of all four corners of quad q */
+        _MM_TRANSPOSE4_PS(c0x, c1x, c2x, c3x);
+        _MM_TRANSPOSE4_PS(c0y, c1y, c2y, c3y);
+
+        alignas(16) float z[4];
+        _mm_store_ps(z, pz);
+
+        const __m128 xs[4] = {c0x, c1x, c2x, c3x};
+        const __m128 ys[4] = {c0y, c1y, c2y, c3y};
+
+        for(int quad = 0; quad < 4; ++quad){
+            uint8_t* vertex = firstVertex + quad * 4 * vertexStride;
+
+            __m128 lowXY = _mm_unpacklo_ps(xs[quad], ys[quad]);
+            __m128 highXY = _mm_unpackhi_ps(xs[quad], ys[quad]);
+
+            _mm_storel_pi(reinterpret_cast<__m64*>(vertex), lowXY);
+            _mm_storeh_pi(reinterpret_cast<__m64*>(vertex + vertexStride), lowXY);
+            _mm_storel_pi(reinterpret_cast<__m64*>(vertex + vertexStride*2), highXY);
+            _mm_storeh_pi(reinterpret_cast<__m64*>(vertex + vertexStride*3), highXY);
+
+            reinterpret_cast<float*>(vertex)[2]                  = z[quad];
+            reinterpret_cast<float*>(vertex + vertexStride)[2]   = z[quad];
+            reinterpret_cast<float*>(vertex + vertexStride*2)[2] = z[quad];
+            reinterpret_cast<float*>(vertex + vertexStride*3)[2] = z[quad];
+        }
+
+    }
+
+    static inline void generateCornersSSE2(const Quad2DTransform* transforms, uint8_t* firstVertex, size_t vertexStride){
+
+        const auto* base = reinterpret_cast<const float*>(transforms);
+
+        /* Load {x, y, z, width} and {width, height, sin, cos} of each quad, then transpose into one field per register */
+        __m128 px = _mm_loadu_ps(base);
+        __m128 py = _mm_loadu_ps(base + 7);
+        __m128 pz = _mm_loadu_ps(base + 14);
+        __m128 width = _mm_loadu_ps(base + 21);
+        _MM_TRANSPOSE4_PS(px, py, pz, width);
+
+        __m128 unusedWidth = _mm_loadu_ps(base + 3);
+        __m128 height = _mm_loadu_ps(base + 10);
+        __m128 sinRotation = _mm_loadu_ps(base + 17);
+        __m128 cosRotation = _mm_loadu_ps(base + 24);
+        _MM_TRANSPOSE4_PS(unusedWidth, height, sinRotation, cosRotation);
+
+        const __m128 half = _mm_set1_ps(0.5f);
+        __m128 hx = _mm_mul_ps(width, half);
+        __m128 hy = _mm_mul_ps(height, half);
+
+        __m128 ax = _mm_mul_ps(cosRotation, hx);
+        __m128 ay = _mm_mul_ps(sinRotation, hx);
+        __m128 bx = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(sinRotation, hy));
+        __m128 by = _mm_mul_ps(cosRotation, hy);
+
+        __m128 pxMinusA = _mm_sub_ps(px, ax), pxPlusA = _mm_add_ps(px, ax);
+        __m128 pyMinusA = _mm_sub_ps(py, ay), pyPlusA = _mm_add_ps(py, ay);
+
+        storeCornersSSE2(_mm_sub_ps(pxMinusA, bx), _mm_sub_ps(pxPlusA, bx), _mm_add_ps(pxPlusA, bx), _mm_add_ps(pxMinusA, bx),
+                         _mm_sub_ps(pyMinusA, by), _mm_sub_ps(pyPlusA, by), _mm_add_ps(pyPlusA, by), _mm_add_ps(pyMinusA, by),
+                         pz, firstVertex, vertexStride);
+
+    }
+
+#endif
+
+#if GEOGL_QUAD_KERNEL_AVX2
+
+    static inline void generateCornersAVX2(const Quad2DTransform* transforms, uint8_t* firstVertex, size_t vertexStride){
+
+        const auto* base = reinterpret_cast<const float*>(transforms);
+
+        /* Each transform is seven floats, so gather every field of eight quads in one go */
+        const __m256i fieldIndices = _mm256_setr_epi32(0, 7, 14, 21, 28, 35, 42, 49);
+        __m256 px = _mm256_i32gather_ps(base, fieldIndices, 4);
+        __m256 py = _mm256_i32gather_ps(base + 1, fieldIndices, 4);
+        __m256 pz = _mm256_i32gather_ps(base + 2, fieldIndices, 4);
+        __m256 width = _mm256_i32gather_ps(base + 3, fieldIndices, 4);
+        __m256 height = _mm256_i32gather_ps(base + 4, fieldIndices, 4);
+        __m256 sinRotation = _mm256_i32gather_ps(base + 5, fieldIndices, 4);
+        __m256 cosRotation = _mm256_i32gather_ps(base + 6, fieldIndices, 4);
+
+        const __m256 half = _mm256_set1_ps(0.5f);
+        __m256 hx = _mm256_mul_ps(width, half);
+        __m256 hy = _mm256_mul_ps(height, half);
+
+        __m256 ax = _mm256_mul_ps(cosRotation, hx);
+        __m256 ay = _mm256_mul_ps(sinRotation, hx);
+        __m256 bx = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(sinRotation, hy));
+        __m256 by = _mm256_mul_ps(cosRotation, hy);
+
+        __m256 pxMinusA = _mm256_sub_ps(px, ax), pxPlusA = _mm256_add_ps(px, ax);
+        __m256 pyMinusA = _mm256_sub_ps(py, ay), pyPlusA = _mm256_add_ps(py, ay);
+
+        __m256 corners[8] = {
+                _mm256_sub_ps(pxMinusA, bx), _mm256_sub_ps(pxPlusA, bx), _mm256_add_ps(pxPlusA, bx), _mm256_add_ps(pxMinusA, bx),
+                _mm256_sub_ps(pyMinusA, by), _mm256_sub_ps(pyPlusA, by), _mm256_add_ps(pyPlusA, by), _mm256_add_ps(pyMinusA, by)
+        };
+
+        /* There is no scatter in AVX2, so store each half with the SSE2 scatter */
+        storeCornersSSE2(_mm256_castps256_ps128(corners[0]), _mm256_castps256_ps128(corners[1]), _mm256_castps256_ps128(corners[2]), _mm256_castps256_ps128(corners[3]),
+                         _mm256_castps256_ps128(corners[4]), _mm256_castps256_ps128(corners[5]), _mm256_castps256_ps128(corners[6]), _mm256_castps256_ps128(corners[7]),
+                         _mm256_castps256_ps128(pz), firstVertex, vertexStride);
+        storeCornersSSE2(_mm256_extractf128_ps(corners[0], 1), _mm256_extractf128_ps(corners[1], 1), _mm256_extractf128_ps(corners[2], 1), _mm256_extractf128_ps(corners[3], 1),
+                         _mm256_extractf128_ps(corners[4], 1), _mm256_extractf128_ps(corners[5], 1), _mm256_extractf128_ps(corners[6], 1), _mm256_extractf128_ps(corners[7], 1),
+                         _mm256_extractf128_ps(pz, 1), firstVertex + 16 * vertexStride, vertexStride);
+
+    }
+
+#endif
+
+    void QuadVertexKernel::generateCorners(const Quad2DTransform* transforms, size_t count, void* firstVertexPosition, size_t vertexStride) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        auto* vertex = static_cast<uint8_t*>(firstVertexPosition);
+        size_t quad = 0;
+
+#if GEOGL_QUAD_KERNEL_AVX2
+        for(; quad + 8 <= count; quad += 8){
+            generateCornersAVX2(transforms + quad, vertex + quad * 4 * vertexStride, vertexStride);
+        }
+#endif
+
+#if GEOGL_QUAD_KERNEL_SSE2
+        for(; quad + 4 <= count; quad += 4){
+            generateCornersSSE2(transforms + quad, vertex + quad * 4 * vertexStride, vertexStride);
+        }
+#endif
+
+        for(; quad < count; ++quad){
+            generateCornersScalar(transforms[quad], vertex + quad * 4 * vertexStride, vertexStride);
+        }
+
+    }
+
+    void QuadVertexKernel::generateCornersReference(const Quad2DTransform* transforms, size_t count, void* firstVertexPosition, size_t vertexStride) {
+
+        static const glm::vec4 quadVertexPositions[4] = {
+                {-0.5f, -0.5f, 0.0f, 1.0f},
+                { 0.5f, -0.5f, 0.0f, 1.0f},
+                { 0.5f,  0.5f, 0.0f, 1.0f},
+                {-0.5f,  0.5f, 0.0f, 1.0f}
+        };
+
+        auto* vertex = static_cast<uint8_t*>(firstVertexPosition);
+
+        for(size_t quad = 0; quad < count; ++quad){
+            const Quad2DTransform& quadTransform = transforms[quad];
+            float rotation = std::atan2(quadTransform.sinRotation, quadTransform.cosRotation);
+
+            glm::mat4 transform = glm::translate(glm::mat4(1.0f), quadTransform.position);
+            transform = (rotation!=0) ? glm::rotate(transform, rotation, {0,0,1}) : transform;
+            transform = glm::scale(transform, {quadTransform.size.x, quadTransform.size.y, 1.0f});
+
+            for(const auto& quadVertexPosition : quadVertexPositions){
+                *reinterpret_cast<glm::vec3*>(vertex) = transform * quadVertexPosition;
+                vertex += vertexStride;
+            }
+        }
+
+    }
+
+    const char* QuadVertexKernel::getInstructionSetName() {
+
+#if GEOGL_QUAD_KERNEL_AVX2
+        return "AVX2";
+#elif GEOGL_QUAD_KERNEL_SSE2
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+
+    }
+
+}
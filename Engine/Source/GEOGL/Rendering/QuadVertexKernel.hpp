@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#ifndef GEOGL_QUADVERTEXKERNEL_HPP
+#define GEOGL_QUADVERTEXKERNEL_HPP
+
+namespace GEOGL{
+
+    /**
+     * \brief Describes the 2D affine transform of a single quad, in the form consumed by the QuadVertexKernel.
+     *
+     * The rotation is stored as its sine and cosine, so that callers with a fixed orientation (or that already
+     * know the sine and cosine of their angle) never pay for the trig inside of the kernel.
+     */
+    struct Quad2DTransform{
+
+        inline Quad2DTransform(const glm::vec3& quadPosition = {0,0,0},
+                               const glm::vec2& quadSize = {1,1},
+                               float quadSinRotation = 0.0f,
+                               float quadCosRotation = 1.0f)
+                               : position(quadPosition), size(quadSize), sinRotation(quadSinRotation), cosRotation(quadCosRotation){};
+
+        /**
+         * \brief Creates a Quad2DTransform from a rotation in radians.
+         */
+        inline static Quad2DTransform fromRotation(const glm::vec3& quadPosition, const glm::vec2& quadSize, float rotation){
+            return rotation != 0 ? Quad2DTransform(quadPosition, quadSize, std::sin(rotation), std::cos(rotation)) : Quad2DTransform(quadPosition, quadSize);
+        };
+
+        /**
+         * \brief Gets the half extents of the axis aligned box around the rotated quad, centered on its position.
+         */
+        inline glm::vec2 getHalfExtents() const {
+            float absSin = std::abs(sinRotation);
+            float absCos = std::abs(cosRotation);
+            return {(absCos * size.x + absSin * size.y) * 0.5f, (absSin * size.x + absCos * size.y) * 0.5f};
+        };
+
+        /**
+         * \brief Tests whether the quad could overlap the axis aligned box from boundsMin to boundsMax.
+         *
+         * Conservative, as it tests the box around the quad, so a rotated quad near a corner of the bounds may pass.
+         */
+        inline bool overlaps(const glm::vec2& boundsMin, const glm::vec2& boundsMax) const {
+            glm::vec2 halfExtents = getHalfExtents();
+            return position.x + halfExtents.x >= boundsMin.x && position.x - halfExtents.x <= boundsMax.x &&
+                   position.y + halfExtents.y >= boundsMin.y && position.y - halfExtents.y <= boundsMax.y;
+        };
+
+        glm::vec3 position;
+        glm::vec2 size;
+        float sinRotation;
+        float cosRotation;
+    };
+
+    /**
+     * \brief Generates the four world space corners of quads directly from their position, size, and rotation.
+     *
+     * This replaces building a glm::mat4 from translate/rotate/scale and doing four mat4*vec4 multiplies per quad,
+     * as the transform of a 2D quad is only ever a 2D affine transform. The corners are generated in the same order
+     * and winding the Renderer2D has always used: bottom left, bottom right, top right, top left.
+     *
+     * The kernel processes quads in groups of eight with AVX2 or four with SSE2, depending on what GEOGL was built
+     * with, and falls back to scalar code for the remainder or when neither is available.
+     */
+    class GEOGL_API QuadVertexKernel{
+    public:
+
+        /**
+         * \brief Writes the corners of count quads into strided vertex storage.
+         *
+         * Corner i of quad q is written to the first 12 bytes of (uint8_t*)firstVertexPosition + (q*4 + i)*vertexStride,
+         * so the positions can be written straight into an interleaved vertex buffer.
+         *
+         * @param transforms The array of quad transforms to generate
+         * @param count The number of quads in transforms
+         * @param firstVertexPosition A pointer to the position of the first vertex to write
+         * @param vertexStride The distance, in bytes, between the positions of two consecutive vertices
+         */
+        static void generateCorners(const Quad2DTransform* transforms, size_t count, void* firstVertexPosition, size_t vertexStride);
+
+        /**
+         * \brief Generates the corners of count quads using the glm::mat4 path the Renderer2D previously used.
+         *
+         * This is kept only as a reference for testing and benchmarking the kernel against.
+         */
+        static void generateCornersReference(const Quad2DTransform* transforms, size_t count, void* firstVertexPosition, size_t vertexStride);
+
+        /**
+         * \brief Gets the name of the instruction set that generateCorners was built with.
+         * @return "AVX2", "SSE2", or "Scalar"
+         */
+        static const char* getInstructionSetName();
+
+    };
+
+}
+
+#endif //GEOGL_QUADVERTEXKERNEL_HPP
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "RadixSort.hpp"
+
+namespace GEOGL{
+
+    void RadixSort::sort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        const size_t count = entries.size();
+        if(count < 2)
+            return;
+
+        scratch.resize(count);
+
+        /* Build the histograms of every byte at once */
+        uint32_t histograms[8][256] = {};
+        for(const auto& entry : entries){
+            for(int byte = 0; byte < 8; ++byte){
+                ++histograms[byte][(entry.key >> (byte * 8)) & 0xFF];
+            }
+        }
+
+        SortEntry* source = entries.data();
+        SortEntry* destination = scratch.data();
+
+        for(int byte = 0; byte < 8; ++byte){
+            uint32_t* histogram = histograms[byte];
+
+            /* If every key shares this byte, the pass would not change the order */
+            if(histogram[(source[0].key >> (byte * 8)) & 0xFF] == count)
+                continue;
+
+            uint32_t offset = 0;
+            for(int bucket = 0; bucket < 256; ++bucket){
+                uint32_t bucketCount = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucketCount;
+            }
+
+            for(size_t i = 0; i < count; ++i){
+                destination[histogram[(source[i].key >> (byte * 8)) & 0xFF]++] = source[i];
+            }
+
+            std::swap(source, destination);
+        }
+
+        /* An odd number of passes leaves the result in the scratch storage */
+        if(source != entries.data())
+            entries.swap(scratch);
+
+    }
+
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_RADIXSORT_HPP
+#define GEOGL_RADIXSORT_HPP
+
+namespace GEOGL{
+
+    /**
+     * \brief A 64 bit sort key, along with the index of the payload it was generated for.
+     */
+    struct SortEntry{
+        uint64_t key;
+        uint32_t index;
+    };
+
+    /**
+     * \brief Sorts SortEntry s by key with a stable least significant digit radix sort.
+     *
+     * The keys are sorted a byte at a time, with all eight histograms built in a single pass over the data. Passes
+     * where every key has the same byte are skipped, which is common as most keys only use a few of their bits.
+     */
+    class GEOGL_API RadixSort{
+    public:
+
+        /**
+         * \brief Sorts entries in ascending order of key. Entries with equal keys keep their relative order.
+         * @param entries The entries to sort
+         * @param scratch Scratch storage, resized to match entries. Keep it around to avoid reallocating every sort.
+         */
+        static void sort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+
+        /**
+         * \brief Maps a float to an unsigned integer that sorts in the same order as the float.
+         */
+        static inline uint32_t floatToSortable(float value){
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            /* Flip every bit of negatives so they sort in reverse, and just the sign bit of positives */
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        };
+
+    };
+
+}
+
+#endif //GEOGL_RADIXSORT_HPP
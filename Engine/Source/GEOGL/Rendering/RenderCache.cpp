@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include "RenderCache.hpp"
+#include "RenderCommand.hpp"
+
+namespace GEOGL{
+
+    RenderCache::RenderCache(uint32_t width, uint32_t height) {
+        GEOGL_PROFILE_FUNCTION();
+
+        FramebufferSpecification framebufferSpecification{};
+        framebufferSpecification.width = std::max(width, 1u);
+        framebufferSpecification.height = std::max(height, 1u);
+        m_Framebuffer = Framebuffer::create(framebufferSpecification);
+
+    }
+
+    void RenderCache::resize(uint32_t width, uint32_t height) {
+
+        width = std::max(width, 1u);
+        height = std::max(height, 1u);
+
+        const FramebufferSpecification& framebufferSpecification = m_Framebuffer->getFramebufferSpecification();
+        if(framebufferSpecification.width == width && framebufferSpecification.height == height)
+            return;
+
+        m_Framebuffer->resize(width, height);
+        m_Dirty = true;
+
+    }
+
+    bool RenderCache::update(const std::function<void()>& render) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        if(!m_Dirty)
+            return false;
+
+        glm::ivec2 viewport = RenderCommand::getViewport();
+        glm::vec4 clearColor = RenderCommand::getClearColor();
+
+        m_Framebuffer->bind();
+        RenderCommand::setClearColor(m_ClearColor);
+        RenderCommand::clear();
+
+        render();
+
+        /* Copies of the color attachment, such as the layers of a TextureArrayTable, have to be refreshed */
+        m_Framebuffer->getColorAttachment()->markContentChanged();
+
+        m_Framebuffer->unbind();
+        RenderCommand::setClearColor(clearColor);
+        RenderCommand::setViewport(viewport);
+
+        m_Dirty = false;
+        return true;
+
+    }
+
+}
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#ifndef GEOGL_RENDERCACHE_HPP
+#define GEOGL_RENDERCACHE_HPP
+
+#include "Framebuffer.hpp"
+
+namespace GEOGL{
+
+    /**
+     * \brief Keeps the output of some rendering in a Framebuffer of its own, and only renders it again once it has
+     * been invalidated.
+     *
+     * Anything that rarely changes, such as a whole layer or a panel of one, can be rendered through update every
+     * frame, which costs nothing until invalidate is called, then drawn with getTexture as a single textured quad.
+     */
+    class GEOGL_API RenderCache{
+    public:
+        /**
+         * \brief Creates a cache of the given size, which is dirty until it is first rendered.
+         */
+        RenderCache(uint32_t width, uint32_t height);
+
+        /**
+         * \brief Marks the cache dirty, so the next update renders it again.
+         */
+        inline void invalidate() { m_Dirty = true; };
+        [[nodiscard]] inline bool isDirty() const { return m_Dirty; };
+
+        /**
+         * \brief Resizes the framebuffer, invalidating the cache if the size changed.
+         */
+        void resize(uint32_t width, uint32_t height);
+
+        /**
+         * \brief Renders into the cache through render if it is dirty, and otherwise does nothing.
+         *
+         * The framebuffer is cleared to the clear color of the cache first, and the viewport and clear color in use
+         * before are restored after.
+         *
+         * @param render Draws the contents of the cache
+         * @return Whether the cache was rendered
+         */
+        bool update(const std::function<void()>& render);
+
+        /**
+         * \brief Sets the color the cache is cleared to before rendering. Transparent by default, so that caches can
+         * be drawn over each other.
+         */
+        inline void setClearColor(const glm::vec4& clearColor) { m_ClearColor = clearColor; m_Dirty = true; };
+
+        [[nodiscard]] inline const Ref<Texture2D>& getTexture() const { return m_Framebuffer->getColorAttachment(); };
+        [[nodiscard]] inline const Ref<Framebuffer>& getFramebuffer() const { return m_Framebuffer; };
+
+    private:
+        Ref<Framebuffer> m_Framebuffer;
+        glm::vec4 m_ClearColor = {0.0f, 0.0f, 0.0f, 0.0f};
+        bool m_Dirty = true;
+    };
+
+}
+
+#endif //GEOGL_RENDERCACHE_HPP
@@ -36,12 +36,14 @@ namespace GEOGL{
         inline static void init(){ s_RendererAPI->init(); };
         inline static void shutdown(){s_RendererAPI->shutdown(); s_RendererAPI.reset(); };
         inline static void setViewport(const glm::ivec2 &dimensions) { s_RendererAPI->setViewport(dimensions); };
+        inline static const glm::ivec2& getViewport() { return s_RendererAPI->getViewport(); };
 
         /**
          * Executes a set clear color command
          * @param color
          */
         inline static void setClearColor(const glm::vec4& color){ s_RendererAPI->setClearColor(color); };
+        inline static const glm::vec4& getClearColor(){ return s_RendererAPI->getClearColor(); };
 
         /**
          * Executes a clear command
@@ -52,7 +54,16 @@ namespace GEOGL{
          * Draws an index vertexArray
          * @param vertexArray
          */
-        inline static void drawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0){ s_RendererAPI->drawIndexed(vertexArray, indexCount); };
+        inline static void drawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0){ s_RendererAPI->drawIndexed(vertexArray, indexCount, baseVertex); };
+
+        /**
+         * Draws instanceCount instances of an indexed vertexArray
+         * @param vertexArray
+         * @param indexCount
+         * @param instanceCount
+         * @param baseInstance
+         */
+        inline static void drawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0){ s_RendererAPI->drawIndexedInstanced(vertexArray, indexCount, instanceCount, baseInstance); };
 
         /**
          * Sets whether or not the render should render wireframe
@@ -60,6 +71,19 @@ namespace GEOGL{
          */
         inline static void renderWireframe(bool* status) { s_RendererAPI->renderWireframe(status); };
 
+        /**
+         * Gets the limits and optional features of the RendererAPI
+         * @return
+         */
+        inline static const RenderCaps& getCapabilities() { return s_RendererAPI->getCapabilities(); };
+
+        /**
+         * Gets how many state changes reached the driver, and how many were skipped as redundant
+         * @return
+         */
+        inline static StateChangeStatistics getStateChangeStatistics() { return s_RendererAPI->getStateChangeStatistics(); };
+        inline static void resetStateChangeStatistics() { s_RendererAPI->resetStateChangeStatistics(); };
+
         /**
          * Gets the rendererAPI
          * @return
@@ -0,0 +1,372 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "RenderThread.hpp"
+
+namespace GEOGL{
+
+    /*
+     * Command List
+     */
+
+    CommandList::~CommandList() {
+
+        reset();
+
+    }
+
+    void* CommandList::stage(const void* data, size_t size) {
+
+        void* memory = allocate(size, 16);
+        memcpy(memory, data, size);
+        return memory;
+
+    }
+
+    void* CommandList::allocate(size_t size, size_t alignment) {
+
+        /* Blocks are never moved or freed while recording, so everything allocated so far stays where it is */
+        while(m_CurrentBlock < m_Blocks.size()){
+            Block& block = m_Blocks[m_CurrentBlock];
+            auto base = (uintptr_t) block.memory.get();
+            uintptr_t address = (base + block.used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+            if(address + size <= base + block.size){
+                block.used = address + size - base;
+                return (void*) address;
+            }
+            ++m_CurrentBlock;
+        }
+
+        Block block;
+        block.size = std::max(s_BlockSize, size + alignment);
+        block.memory = std::make_unique<uint8_t[]>(block.size);
+        m_Blocks.push_back(std::move(block));
+        m_CurrentBlock = m_Blocks.size() - 1;
+
+        return allocate(size, alignment);
+
+    }
+
+    void CommandList::execute() {
+        GEOGL_PROFILE_FUNCTION();
+
+        for(auto& command : m_Commands){
+            command.invoke(command.memory, true);
+        }
+        m_Commands.clear();
+
+        reset();
+
+    }
+
+    void CommandList::reset() {
+
+        for(auto& command : m_Commands){
+            command.invoke(command.memory, false);
+        }
+        m_Commands.clear();
+
+        for(auto& block : m_Blocks){
+            block.used = 0;
+        }
+        m_CurrentBlock = 0;
+
+    }
+
+    size_t CommandList::getUsedBytes() const {
+
+        size_t usedBytes = 0;
+        for(const auto& block : m_Blocks){
+            usedBytes += block.used;
+        }
+        return usedBytes;
+
+    }
+
+    /*
+     * Render Thread
+     */
+
+    /**
+     * \brief Hands command lists from exactly one thread to exactly one other without locking.
+     */
+    class CommandListQueue{
+    public:
+        bool push(CommandList* commandList){
+            size_t tail = m_Tail.load(std::memory_order_relaxed);
+            size_t next = (tail + 1) % s_Capacity;
+            if(next == m_Head.load(std::memory_order_acquire))
+                return false;
+
+            m_CommandLists[tail] = commandList;
+            m_Tail.store(next, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(CommandList*& commandList){
+            size_t head = m_Head.load(std::memory_order_relaxed);
+            if(head == m_Tail.load(std::memory_order_acquire))
+                return false;
+
+            commandList = m_CommandLists[head];
+            m_Head.store((head + 1) % s_Capacity, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        /* One slot always stays empty, so this holds every list of triple buffering */
+        static constexpr size_t s_Capacity = 4;
+
+        std::array<CommandList*, s_Capacity> m_CommandLists{};
+        alignas(64) std::atomic<size_t> m_Head{0};
+        alignas(64) std::atomic<size_t> m_Tail{0};
+    };
+
+    /**
+     * \brief Yields for short waits and sleeps for long ones, so an idle render thread costs next to nothing.
+     */
+    class Backoff{
+    public:
+        void wait(){
+            ++m_Attempts;
+            if(m_Attempts < 64)
+                std::this_thread::yield();
+            else if(m_Attempts < 4096)
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            else
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        inline void reset() { m_Attempts = 0; };
+
+    private:
+        uint32_t m_Attempts = 0;
+    };
+
+    struct ExecuteRequest{
+        void (*function)(void*);
+        void* userData;
+        std::atomic<bool> done{false};
+    };
+
+    static bool s_Enabled = false;
+    static uint32_t s_FramesInFlight = 2;
+
+    static std::thread s_Thread;
+    static GraphicsContext* s_Context = nullptr;
+    static std::atomic<bool> s_Running{false};
+    static std::atomic<bool> s_StopRequested{false};
+    static thread_local bool s_IsRenderThread = false;
+
+    static std::vector<std::unique_ptr<CommandList>> s_CommandLists;
+    static CommandList* s_RecordingList = nullptr;
+    static CommandListQueue s_SubmittedLists;
+    static CommandListQueue s_FreeLists;
+    static std::atomic<ExecuteRequest*> s_ExecuteRequest{nullptr};
+
+    static void serviceExecuteRequest(){
+
+        ExecuteRequest* request = s_ExecuteRequest.exchange(nullptr, std::memory_order_acquire);
+        if(request){
+            request->function(request->userData);
+            request->done.store(true, std::memory_order_release);
+        }
+
+    }
+
+    static void renderThreadMain(GraphicsContext* context){
+
+        s_IsRenderThread = true;
+        if(context)
+            context->makeCurrent();
+
+        Backoff backoff;
+        while(true){
+            serviceExecuteRequest();
+
+            CommandList* commandList = nullptr;
+            if(s_SubmittedLists.pop(commandList)){
+                GEOGL_PROFILE_SCOPE("Render Thread Frame");
+                commandList->execute();
+                s_FreeLists.push(commandList);
+                backoff.reset();
+                continue;
+            }
+
+            /* The last frame is submitted before stopping is requested, so it is visible by now */
+            if(s_StopRequested.load(std::memory_order_acquire)){
+                while(s_SubmittedLists.pop(commandList)){
+                    commandList->execute();
+                    s_FreeLists.push(commandList);
+                }
+                break;
+            }
+
+            backoff.wait();
+        }
+
+        if(context)
+            context->releaseCurrent();
+        s_IsRenderThread = false;
+
+    }
+
+    void RenderThread::setEnabled(bool enabled, uint32_t framesInFlight) {
+
+        GEOGL_CORE_ASSERT(!isRunning(), "The render thread cannot be reconfigured while it is running.");
+
+        s_Enabled = enabled;
+        s_FramesInFlight = std::clamp<uint32_t>(framesInFlight, 2, 3);
+        if(s_FramesInFlight != framesInFlight)
+            GEOGL_CORE_WARN("The render thread supports 2 or 3 frames in flight, not {}. Using {}.", framesInFlight, s_FramesInFlight);
+
+    }
+
+    bool RenderThread::isEnabled() {
+
+        return s_Enabled;
+
+    }
+
+    uint32_t RenderThread::getFramesInFlight() {
+
+        return s_FramesInFlight;
+
+    }
+
+    void RenderThread::start(GraphicsContext* context) {
+        GEOGL_PROFILE_FUNCTION();
+
+        if(!s_Enabled || isRunning())
+            return;
+
+        s_CommandLists.resize(s_FramesInFlight);
+        for(auto& commandList : s_CommandLists){
+            if(!commandList)
+                commandList = std::make_unique<CommandList>();
+        }
+
+        s_RecordingList = s_CommandLists[0].get();
+        for(size_t i = 1; i < s_CommandLists.size(); ++i){
+            s_FreeLists.push(s_CommandLists[i].get());
+        }
+
+        /* A context is current on one thread at a time, so it has to be let go before the render thread takes it */
+        s_Context = context;
+        if(s_Context)
+            s_Context->releaseCurrent();
+
+        s_StopRequested = false;
+        s_Thread = std::thread(renderThreadMain, s_Context);
+        s_Running = true;
+
+        GEOGL_CORE_INFO("Started the render thread with {} frames in flight.", s_FramesInFlight);
+
+    }
+
+    void RenderThread::stop() {
+        GEOGL_PROFILE_FUNCTION();
+
+        if(!isRunning())
+            return;
+
+        s_SubmittedLists.push(s_RecordingList);
+        s_RecordingList = nullptr;
+
+        s_StopRequested.store(true, std::memory_order_release);
+        s_Thread.join();
+        s_Running = false;
+
+        /* Every list has been rendered and returned, so empty the queue for the next start */
+        CommandList* commandList = nullptr;
+        while(s_FreeLists.pop(commandList));
+
+        if(s_Context)
+            s_Context->makeCurrent();
+        s_Context = nullptr;
+
+        GEOGL_CORE_INFO("Stopped the render thread.");
+
+    }
+
+    bool RenderThread::isRunning() {
+
+        return s_Running.load(std::memory_order_acquire);
+
+    }
+
+    bool RenderThread::isRenderThread() {
+
+        return s_IsRenderThread;
+
+    }
+
+    const void* RenderThread::stage(const void* data, size_t size) {
+
+        CommandList* commandList = getRecordingList();
+        return commandList ? commandList->stage(data, size) : data;
+
+    }
+
+    void RenderThread::endFrame() {
+        GEOGL_PROFILE_FUNCTION();
+
+        if(!s_RecordingList)
+            return;
+
+        s_SubmittedLists.push(s_RecordingList);
+        s_RecordingList = nullptr;
+
+        /* Waiting here is what keeps the main thread at most the frames in flight ahead of the render thread */
+        CommandList* commandList = nullptr;
+        Backoff backoff;
+        while(!s_FreeLists.pop(commandList)){
+            backoff.wait();
+        }
+        s_RecordingList = commandList;
+
+    }
+
+    CommandList* RenderThread::getRecordingList() {
+
+        return s_IsRenderThread ? nullptr : s_RecordingList;
+
+    }
+
+    void RenderThread::executeOnRenderThread(void (*function)(void*), void* userData) {
+        GEOGL_PROFILE_FUNCTION();
+
+        ExecuteRequest request;
+        request.function = function;
+        request.userData = userData;
+        s_ExecuteRequest.store(&request, std::memory_order_release);
+
+        Backoff backoff;
+        while(!request.done.load(std::memory_order_acquire)){
+            backoff.wait();
+        }
+
+    }
+
+}
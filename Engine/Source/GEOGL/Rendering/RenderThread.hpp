@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_RENDERTHREAD_HPP
+#define GEOGL_RENDERTHREAD_HPP
+
+#include "GraphicsContext.hpp"
+
+namespace GEOGL{
+
+    /**
+     * \brief A frame's worth of recorded render commands.
+     *
+     * The commands, and any data they upload, are placed in blocks of memory that are kept from frame to frame, so
+     * once the blocks have grown to the size of a frame, recording a command allocates nothing.
+     */
+    class GEOGL_API CommandList{
+    public:
+        CommandList() = default;
+        ~CommandList();
+
+        CommandList(const CommandList&) = delete;
+        CommandList& operator=(const CommandList&) = delete;
+
+        /**
+         * \brief Records a command, which is moved into the list and destroyed once it has been executed.
+         */
+        template<typename Function>
+        void record(Function&& function){
+            using Command = std::decay_t<Function>;
+
+            void* memory = allocate(sizeof(Command), alignof(Command));
+            new (memory) Command(std::forward<Function>(function));
+            m_Commands.push_back({&CommandList::invoke<Command>, memory});
+        }
+
+        /**
+         * \brief Copies data into the list, where it stays until the list is next reset.
+         * @return The copy, for the commands of this list to read from
+         */
+        void* stage(const void* data, size_t size);
+
+        /**
+         * \brief Allocates memory that stays valid until the list is next reset.
+         */
+        void* allocate(size_t size, size_t alignment);
+
+        /**
+         * \brief Executes the commands in the order they were recorded, then resets the list.
+         */
+        void execute();
+
+        /**
+         * \brief Destroys the commands without executing them.
+         */
+        void reset();
+
+        [[nodiscard]] inline size_t getCommandCount() const { return m_Commands.size(); };
+
+        /**
+         * \brief The bytes of commands and staged data recorded since the last reset.
+         */
+        [[nodiscard]] size_t getUsedBytes() const;
+
+    private:
+        template<typename Command>
+        static void invoke(void* memory, bool execute){
+            auto* command = static_cast<Command*>(memory);
+            if(execute)
+                (*command)();
+            command->~Command();
+        }
+
+        struct RecordedCommand{
+            void (*invoke)(void* memory, bool execute);
+            void* memory;
+        };
+
+        struct Block{
+            std::unique_ptr<uint8_t[]> memory;
+            size_t size = 0;
+            size_t used = 0;
+        };
+
+        static constexpr size_t s_BlockSize = 1024 * 1024;
+
+        std::vector<RecordedCommand> m_Commands;
+        std::vector<Block> m_Blocks;
+        size_t m_CurrentBlock = 0;
+
+    };
+
+    /**
+     * \brief Runs the graphics API on a thread of its own, so the simulation of the next frame overlaps with the
+     * submission of the last.
+     *
+     * Platform code sends everything that touches the graphics API through submit or execute. While the thread is not
+     * running, both run the function immediately, so nothing changes unless the Application enables the thread. While
+     * it is running, submit records the function into the frame's CommandList, and endFrame hands the list to the
+     * render thread through a lock free queue, which replays it while the main thread records the next one.
+     *
+     * Commands run after the function that submitted them has returned, and possibly after the object that submitted
+     * them has been destroyed, so they must capture what they need by value, and use stage for any data they upload.
+     */
+    class GEOGL_API RenderThread{
+    public:
+        /**
+         * \brief Selects whether the Application runs a render thread. Must be set before the Renderer is
+         * initialized, since the platform picks how it streams vertices when the buffers are created.
+         *
+         * @param enabled Whether to run a render thread
+         * @param framesInFlight The frames that may be recorded or waiting to be rendered at once, 2 or 3.
+         */
+        static void setEnabled(bool enabled, uint32_t framesInFlight = 2);
+        static bool isEnabled();
+        static uint32_t getFramesInFlight();
+
+        /**
+         * \brief Starts the render thread, moving the context to it. Does nothing unless the thread is enabled.
+         * @param context The context to render with, or nullptr if the platform has none.
+         */
+        static void start(GraphicsContext* context);
+
+        /**
+         * \brief Renders every frame already ended, stops the render thread, and moves the context back to the
+         * calling thread.
+         */
+        static void stop();
+
+        static bool isRunning();
+        static bool isRenderThread();
+
+        /**
+         * \brief Runs function on the render thread, in order with everything else submitted. Runs it immediately
+         * when the render thread is not running, or when called from the render thread itself.
+         */
+        template<typename Function>
+        static void submit(Function&& function){
+            if(CommandList* commandList = getRecordingList())
+                commandList->record(std::forward<Function>(function));
+            else
+                function();
+        }
+
+        /**
+         * \brief Runs function on the render thread, and waits for it to return.
+         *
+         * This is meant for creating resources, whose names are needed immediately. The function runs between two
+         * frames, ahead of any frames still waiting to be rendered, so it must not depend on anything that was
+         * submitted and not yet rendered.
+         */
+        template<typename Function>
+        static void execute(Function&& function){
+            using Callable = std::remove_reference_t<Function>;
+
+            if(!getRecordingList()){
+                function();
+                return;
+            }
+            executeOnRenderThread([](void* callable){ (*static_cast<Callable*>(callable))(); }, (void*) &function);
+        }
+
+        /**
+         * \brief Copies data for a submitted command to read from. Returns data itself when commands run immediately.
+         */
+        static const void* stage(const void* data, size_t size);
+
+        /**
+         * \brief Hands the frame recorded so far to the render thread, waiting if every frame in flight is still
+         * being rendered. Does nothing when the render thread is not running.
+         */
+        static void endFrame();
+
+    private:
+        static CommandList* getRecordingList();
+        static void executeOnRenderThread(void (*function)(void*), void* userData);
+
+    };
+
+}
+
+#endif //GEOGL_RENDERTHREAD_HPP
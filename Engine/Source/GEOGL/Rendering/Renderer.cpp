@@ -26,27 +26,38 @@
 #include "Renderer.hpp"
 
 
-#if GEOGL_BUILD_WITH_OPENGL == 1
-#include "../../Platform/OpenGL/Rendering/OpenGLShader.hpp"
 #include "Renderer2D.hpp"
 
-#endif
-
 namespace GEOGL{
 
     Renderer::SceneData* Renderer::m_SceneData = nullptr;
 
-    void Renderer::init(const std::string& applicationResourceDirectory){
+    /* The number of transforms submitted before the ring wraps around and is orphaned */
+    static const uint32_t s_TransformRingSlots = 1024;
+
+    void Renderer::init(const Renderer2D::BatchProperties& batchProperties){
         GEOGL_PROFILE_FUNCTION();
 
         m_SceneData = new SceneData;
         RenderCommand::init();
-        Renderer2D::init(applicationResourceDirectory);
+
+        /* The blocks must be named before the first shader links */
+        Shader::setUniformBlockBinding("Camera", CAMERA_BLOCK_BINDING);
+        Shader::setUniformBlockBinding("Transform", TRANSFORM_BLOCK_BINDING);
+
+        m_SceneData->cameraBuffer = UniformBuffer::create(sizeof(glm::mat4), CAMERA_BLOCK_BINDING);
+
+        m_SceneData->transformRing = createScope<UniformBufferRing>((uint32_t) sizeof(glm::mat4), s_TransformRingSlots, TRANSFORM_BLOCK_BINDING);
+
+        Renderer2D::init(batchProperties);
 
     }
 
     void Renderer::shutdown() {
 
+        m_SceneData->cameraBuffer = nullptr;
+        m_SceneData->transformRing = nullptr;
+
         RenderCommand::shutdown();
         Renderer2D::shutdown();
 
@@ -64,6 +75,16 @@ namespace GEOGL{
 
         GEOGL_CORE_ASSERT(m_SceneData, "Renderer::init not called before Renderer::beginScene");
         m_SceneData->projectionViewMatrix = camera.getProjectionViewMatrix();
+        setCamera(m_SceneData->projectionViewMatrix);
+
+    }
+
+    void Renderer::setCamera(const glm::mat4& projectionViewMatrix) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        GEOGL_CORE_ASSERT(m_SceneData, "Renderer::init not called before Renderer::setCamera");
+        m_SceneData->cameraBuffer->setData(glm::value_ptr(projectionViewMatrix), sizeof(glm::mat4));
+        m_SceneData->cameraBuffer->bind();
 
     }
 
@@ -75,8 +96,10 @@ namespace GEOGL{
         GEOGL_PROFILE_FUNCTION();
 
         shader->bind();
-        std::dynamic_pointer_cast<GEOGL::Platform::OpenGL::Shader>(shader)->uploadUniformMat4("u_ProjectionViewMatrix", m_SceneData->projectionViewMatrix);
-        std::dynamic_pointer_cast<GEOGL::Platform::OpenGL::Shader>(shader)->uploadUniformMat4("u_TransformMatrix", transform);
+
+        /* Shaders read the camera from the Camera block, and the transform from its slot of the Transform block */
+        m_SceneData->transformRing->push(glm::value_ptr(transform));
+
         vertexArray->bind();
         RenderCommand::drawIndexed(vertexArray);
 
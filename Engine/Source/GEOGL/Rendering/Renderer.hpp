@@ -29,13 +29,24 @@
 #include "Camera.hpp"
 #include "RenderCommand.hpp"
 #include "Shader.hpp"
+#include "Renderer2D.hpp"
 
 namespace GEOGL{
 
     class GEOGL_API Renderer{
     public:
+        /**
+         * \brief The binding points of the uniform blocks the Renderer keeps up to date. Shaders read them with
+         * \code
+         * layout(std140) uniform Camera{ mat4 u_ProjectionViewMatrix; };
+         * layout(std140) uniform Transform{ mat4 u_TransformMatrix; };
+         * \endcode
+         */
+        static constexpr uint32_t CAMERA_BLOCK_BINDING = 0;
+        static constexpr uint32_t TRANSFORM_BLOCK_BINDING = 1;
 
-        static void init(const std::string& applicationResourceDirectory);
+
+        static void init(const Renderer2D::BatchProperties& batchProperties = Renderer2D::BatchProperties());
         static void shutdown();
         static void onWindowResize(const glm::ivec2& dimensions);
 
@@ -58,7 +69,15 @@ namespace GEOGL{
         static void endScene();
 
         /**
-         * \brief Submit a VertexArray for drawing
+         * \brief Writes the Camera uniform block shared by every shader. Both Renderer and Renderer2D call this from
+         * beginScene, so switching shaders during the scene does not upload the camera again.
+         * @param projectionViewMatrix The projection view matrix of the camera
+         */
+        static void setCamera(const glm::mat4& projectionViewMatrix);
+
+        /**
+         * \brief Submit a VertexArray for drawing. The transform is written to the Transform block, which shaders
+         * declare with #include <GEOGL/Transform.glsl>.
          * @param vertexArray The vertex array to submit
          */
         static void submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f));
@@ -78,6 +97,11 @@ namespace GEOGL{
     private:
         struct SceneData{
             glm::mat4 projectionViewMatrix;
+
+            Ref<UniformBuffer> cameraBuffer;
+
+            /* A ring of Transform blocks, one per submit, each bound with its own range */
+            Scope<UniformBufferRing> transformRing;
         };
 
         static SceneData* m_SceneData;
@@ -24,8 +24,14 @@
 
 
 #include "Renderer2D.hpp"
+#include "Renderer.hpp"
 #include <GEOGL/Platform/OpenGL.hpp>
 #include "RenderCommand.hpp"
+#include "QuadVertexKernel.hpp"
+#include "RadixSort.hpp"
+#include "TextureTable.hpp"
+
+#include <glm/gtc/packing.hpp>
 
 namespace GEOGL{
 
@@ -34,89 +40,482 @@ namespace GEOGL{
         glm::vec4 color;
         glm::vec2 textureCoord;
         float tilingFactor;
+        uint32_t textureIndex;
+    };
+
+    /**
+     * \brief The vertex of VertexFormat::COMPACT, 24 bytes to the 44 of QuadVertex.
+     */
+    struct CompactQuadVertex{
+        glm::vec3 position;
+        uint32_t color;         /* RGBA8, normalized */
+        uint32_t textureCoord;  /* Two unorm16 */
+        uint16_t tilingFactor;  /* Half float */
+        uint16_t textureIndex;
+    };
+    static_assert(sizeof(CompactQuadVertex) == 24, "CompactQuadVertex must stay 24 bytes");
+
+    /**
+     * \brief The per instance record of QuadMode::INSTANCED. The vertex shader expands it into the four corners.
+     */
+    struct QuadInstanceVertex{
+        Quad2DTransform transform;
+        glm::vec4 color;
+        glm::vec4 textureRect;
+        float tilingFactor;
         float textureIndex;
-        //TODO: color, texid
+    };
+    static_assert(sizeof(QuadInstanceVertex) == 17 * sizeof(float), "QuadInstanceVertex should not upload padding with every instance");
+
+    /**
+     * \brief An entry of the texture palette used by drawQuads.
+     */
+    struct QuadTexture{
+        TextureHandle texture;
+        const glm::vec2* textureCoords;
+    };
+
+    /**
+     * \brief A RecordingContext handed to Renderer2D::submit, to be merged at endScene.
+     */
+    struct SubmittedContext{
+        Renderer2D::RecordingContext* context;
+        uint32_t mergeOrder;
+    };
+
+    /**
+     * \brief The slot a texture is bound to. Only valid while batchStamp matches the current batch.
+     */
+    struct TextureSlotEntry{
+        uint32_t batchStamp = 0;
+        uint32_t generation = 0;
+        float textureIndex = 0;
     };
 
     struct Renderer2DData{
-        const uint32_t maxQuads = 7500;
-        const uint32_t maxVertices = maxQuads * 4;
-        const uint32_t maxIndices = maxQuads * 6;
-        static const uint32_t maxTextureSlots = 32; //TODO: Get from RenderCaps
+        /* Sized by init from the BatchProperties and RenderCaps. maxQuads grows with adaptive batch sizing */
+        uint32_t maxQuads = 0;
+        uint32_t maxIndices = 0;
+        uint32_t maxTextureSlots = 0;
+
+        /* Adaptive batch sizing. A scene that overflowed a batch grows the batch to fit it at the next beginScene */
+        bool adaptiveBatchSize = false;
+        uint32_t sceneQuadCount = 0;
+        uint32_t sceneCapacityFlushes = 0;
+        uint32_t pendingMaxQuads = 0;
 
         Ref<VertexArray> quadVertexArray;
-        Ref<VertexBuffer> quadVertexBuffer;
+        Ref<StreamVertexBuffer> quadVertexBuffer;
 
         Ref<Shader> textureShader;
         Ref<Texture2D> whiteTexture;
 
+        /* The variant of textureShader without texturing, for batches of plain colored quads. Created the first time
+         * a batch like that is flushed */
+        std::string textureShaderName;
+        Ref<Shader> colorShader;
+
+        /* Static batches always use full vertices and texture slots. Their shader is only created if textureShader
+         * is set up any other way, and their index buffer is shared between them */
+        Ref<Shader> staticBatchShader;
+        Ref<IndexBuffer> staticBatchIndexBuffer;
+
+        /* Created the first time a TileMap is drawn. Every chunk is drawn as the same unit quad */
+        Ref<Shader> tileMapShader;
+        Ref<VertexArray> tileMapVertexArray;
+
+        Renderer2D::QuadMode quadMode = Renderer2D::QuadMode::VERTICES;
+        Renderer2D::VertexFormat vertexFormat = Renderer2D::VertexFormat::FULL;
+
+        /* The Base pointers point directly into the current region of quadVertexBuffer */
         uint32_t quadIndexCount = 0;
         QuadVertex* quadVertexBufferBase = nullptr;
         QuadVertex* quadVertexBufferPtr = nullptr;
+        CompactQuadVertex* compactVertexBufferBase = nullptr;
+        CompactQuadVertex* compactVertexBufferPtr = nullptr;
+        QuadInstanceVertex* quadInstanceBufferBase = nullptr;
+        QuadInstanceVertex* quadInstanceBufferPtr = nullptr;
 
-        glm::vec4 quadVertexPositions[4] = {};
-
-        //TODO: GUID identifier
-        std::array<Ref<Texture2D>, maxTextureSlots> textureSlots;
+        /* The textures of the current batch, which are only pinned here, once per batch */
+        std::vector<Ref<Texture2D>> textureSlots;
         uint32_t textureSlotIndex = 0;
 
+        /* Set unless textures are bound to slots. Holds far more textures per batch than there are slots */
+        Renderer2D::TextureBinding textureBinding = Renderer2D::TextureBinding::SLOTS;
+        Ref<TextureTable> textureTable;
+
+        /* Indexed by renderer ID, so finding the slot of a texture is a single lookup instead of a scan */
+        std::vector<TextureSlotEntry> textureSlotTable;
+        uint32_t batchStamp = 1;
+
+        /* Scratch storage for the texture palette of drawQuads, kept to avoid allocating every call */
+        std::vector<QuadTexture> quadTexturePalette;
+
+        Renderer2D::SubmissionMode submissionMode = Renderer2D::SubmissionMode::IMMEDIATE;
+        std::vector<Renderer2D::RecordedQuad> deferredQuads;
+        std::vector<SortEntry> deferredSortEntries;
+        std::vector<SortEntry> deferredSortScratch;
+
+        std::vector<SubmittedContext> submittedContexts;
+        /* Scratch storage for the batch texture index of each texture of a segment being merged */
+        std::vector<float> segmentTextureIndices;
+
         Renderer2D::Statistics stats{};
 
+        /* The world space rectangle the camera sees. Infinite while view culling is off, so every quad passes */
+        bool viewCulling = true;
+        glm::vec2 viewBoundsMin{0.0f};
+        glm::vec2 viewBoundsMax{0.0f};
+
         bool wireframe = false;
     };
 
 
     static Renderer2DData s_Data;
-    static glm::mat4 s_IdentMatrix;
 
-    void GEOGL::Renderer2D::init(const std::string& applicationResourceDirectory) {
+    /* The batch size used when the BatchProperties do not specify one */
+    static const uint32_t s_DefaultMaxQuads = 10000;
+    /* Adaptive batch sizing never grows past this, to bound the memory of the stream buffer's regions */
+    static const uint32_t s_MaxAdaptiveQuads = 1 << 16;
+    /* The stream buffer holds as many batches as fit in this, so several frames can be in flight before a region
+     * has to wait for the GPU. Huge batches still get a few regions, and small ones do not get an endless ring */
+    static const uint32_t s_StreamBufferBytes = 32 << 20;
+    static const uint32_t s_MinStreamRegions = 3;
+    static const uint32_t s_MaxStreamRegions = 64;
+    /* The most quads in a segment of a finished RecordingContext, so that segments outside of the view can be culled */
+    static const uint32_t s_MaxSegmentQuads = 1024;
+    static const glm::vec2 s_TextureCoords[] = {{0,0}, {1,0}, {1,1}, {0,1}};
+    static const glm::vec4 s_WhiteColor = {1,1,1,1};
+
+    /* Uniforms set every batch, hashed at compile time */
+    static constexpr UniformID s_TexturesUniform = "u_Textures";
+    static constexpr UniformID s_TilesUniform = "u_Tiles";
+    static constexpr UniformID s_TextureAtlasUniform = "u_TextureAtlas";
+    static constexpr UniformID s_AtlasColumnsUniform = "u_AtlasColumns";
+    static constexpr UniformID s_CellSizeUniform = "u_CellSize";
+    static constexpr UniformID s_ChunkPositionUniform = "u_ChunkPosition";
+    static constexpr UniformID s_ChunkSizeUniform = "u_ChunkSize";
+    static constexpr UniformID s_ChunkTilesUniform = "u_ChunkTiles";
+
+    static void emitDeferredQuads();
+
+    /**
+     * \brief Points the batch at the region of the stream buffer that is currently free for writing.
+     */
+    static void resetBatch(){
+
+        void* writePointer = s_Data.quadVertexBuffer->getWritePointer();
+
+        if(s_Data.quadMode == Renderer2D::QuadMode::INSTANCED){
+            s_Data.quadInstanceBufferBase = static_cast<QuadInstanceVertex*>(writePointer);
+            s_Data.quadInstanceBufferPtr = s_Data.quadInstanceBufferBase;
+        }else if(s_Data.vertexFormat == Renderer2D::VertexFormat::COMPACT){
+            s_Data.compactVertexBufferBase = static_cast<CompactQuadVertex*>(writePointer);
+            s_Data.compactVertexBufferPtr = s_Data.compactVertexBufferBase;
+        }else{
+            s_Data.quadVertexBufferBase = static_cast<QuadVertex*>(writePointer);
+            s_Data.quadVertexBufferPtr = s_Data.quadVertexBufferBase;
+        }
+
+        s_Data.quadIndexCount = 0;
+        s_Data.textureSlotIndex = 0;
+        if(s_Data.textureTable)
+            s_Data.textureTable->reset();
+
+        /* Bumping the stamp invalidates every slot in the table at once. Clear it on the rare wrap around */
+        if(++s_Data.batchStamp == 0){
+            std::fill(s_Data.textureSlotTable.begin(), s_Data.textureSlotTable.end(), TextureSlotEntry());
+            s_Data.batchStamp = 1;
+        }
+
+    }
+
+    /**
+     * \brief Creates an index buffer drawing quadCount quads of four vertices each.
+     */
+    static Ref<IndexBuffer> createQuadIndexBuffer(uint32_t quadCount){
+
+        uint32_t indexCount = quadCount * 6;
+        auto *quadIndices = new uint32_t[indexCount];
+
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < indexCount; i += 6) {
+            quadIndices[i + 0] = offset + 0;
+            quadIndices[i + 1] = offset + 1;
+            quadIndices[i + 2] = offset + 2;
+
+            quadIndices[i + 3] = offset + 2;
+            quadIndices[i + 4] = offset + 3;
+            quadIndices[i + 5] = offset + 0;
+
+            offset += 4;
+        }
+
+        auto quadIB = IndexBuffer::create(quadIndices, indexCount);
+        delete[] quadIndices;
+
+        return quadIB;
+
+    }
+
+    /**
+     * \brief The layout of QuadVertex.
+     */
+    static constexpr auto s_QuadVertexLayout = makeBufferLayout<QuadVertex>(
+            GEOGL_VERTEX_ELEMENT(QuadVertex, position, "a_Position"),
+            GEOGL_VERTEX_ELEMENT(QuadVertex, color, "a_Color"),
+            GEOGL_VERTEX_ELEMENT(QuadVertex, textureCoord, "a_TextureCoord"),
+            GEOGL_VERTEX_ELEMENT(QuadVertex, tilingFactor, "a_TilingFactor"),
+            GEOGL_VERTEX_ELEMENT(QuadVertex, textureIndex, "a_TextureIndex"));
+
+    /**
+     * \brief The layout of CompactQuadVertex. The shader reads the same types as from QuadVertex, as the normalized
+     * integers and half floats are converted back to floats, while the texture index is an integer either way.
+     */
+    static constexpr auto s_CompactQuadVertexLayout = makeBufferLayout<CompactQuadVertex>(
+            GEOGL_VERTEX_ELEMENT(CompactQuadVertex, position, "a_Position"),
+            GEOGL_VERTEX_ELEMENT_AS(CompactQuadVertex, color, ShaderDataType::UBYTE4, "a_Color", true),
+            GEOGL_VERTEX_ELEMENT_AS(CompactQuadVertex, textureCoord, ShaderDataType::USHORT2, "a_TextureCoord", true),
+            GEOGL_VERTEX_ELEMENT_AS(CompactQuadVertex, tilingFactor, ShaderDataType::HALF, "a_TilingFactor", false),
+            GEOGL_VERTEX_ELEMENT(CompactQuadVertex, textureIndex, "a_TextureIndex"));
+
+    /**
+     * \brief The layout of QuadInstanceVertex, stepping once per quad instead of once per vertex. The sine and cosine
+     * of the rotation are read together.
+     */
+    static constexpr auto s_QuadInstanceVertexLayout = makeBufferLayout<QuadInstanceVertex, 1>(
+            GEOGL_VERTEX_ELEMENT(QuadInstanceVertex, transform.position, "a_Position"),
+            GEOGL_VERTEX_ELEMENT(QuadInstanceVertex, transform.size, "a_Size"),
+            GEOGL_VERTEX_ELEMENT_AS(QuadInstanceVertex, transform.sinRotation, ShaderDataType::FLOAT2, "a_Rotation", false),
+            GEOGL_VERTEX_ELEMENT(QuadInstanceVertex, color, "a_Color"),
+            GEOGL_VERTEX_ELEMENT(QuadInstanceVertex, textureRect, "a_TextureRect"),
+            GEOGL_VERTEX_ELEMENT(QuadInstanceVertex, tilingFactor, "a_TilingFactor"),
+            GEOGL_VERTEX_ELEMENT(QuadInstanceVertex, textureIndex, "a_TextureIndex"));
+
+    /**
+     * \brief Creates the stream buffer batches are written to, with regions of regionSize bytes.
+     */
+    static Ref<StreamVertexBuffer> createQuadStreamBuffer(uint32_t regionSize){
+
+        uint32_t regionCount = std::clamp(s_StreamBufferBytes / regionSize, s_MinStreamRegions, s_MaxStreamRegions);
+        return StreamVertexBuffer::create(regionSize, regionCount);
+
+    }
+
+    /**
+     * \brief Creates the vertex array, stream buffer and index buffer for batches of maxQuads quads.
+     */
+    static void createBatchBuffers(uint32_t maxQuads){
         GEOGL_PROFILE_FUNCTION();
 
-        /* Store a blank identity matrix to save on compute */
-        s_IdentMatrix = glm::mat4(1.0f);
+        s_Data.maxQuads = maxQuads;
+        s_Data.maxIndices = maxQuads * 6;
+        bool instanced = s_Data.quadMode == Renderer2D::QuadMode::INSTANCED;
 
         s_Data.quadVertexArray = VertexArray::create();
 
+        /* Create the quad instance Buffer, stepping once per quad instead of once per vertex */
+        if(instanced){
+            s_Data.quadVertexBuffer = createQuadStreamBuffer(s_Data.maxQuads * sizeof(QuadInstanceVertex));
+            s_Data.quadVertexBuffer->setLayout(s_QuadInstanceVertexLayout);
+            s_Data.quadVertexArray->addVertexBuffer(s_Data.quadVertexBuffer);
+        }
+
+        /* Create the compact quad vertex Buffer */
+        if(!instanced && s_Data.vertexFormat == Renderer2D::VertexFormat::COMPACT){
+            s_Data.quadVertexBuffer = createQuadStreamBuffer(s_Data.maxQuads * 4 * sizeof(CompactQuadVertex));
+            s_Data.quadVertexBuffer->setLayout(s_CompactQuadVertexLayout);
+            s_Data.quadVertexArray->addVertexBuffer(s_Data.quadVertexBuffer);
+        }
+
         /* Create the quad vertex Buffer */
-        {
-            s_Data.quadVertexBuffer = VertexBuffer::create(s_Data.maxVertices * sizeof(QuadVertex));
-            {
-                s_Data.quadVertexBuffer->setLayout({
-                                                           {ShaderDataType::FLOAT3, "a_Position"},
-                                                           {ShaderDataType::FLOAT4, "a_Color"},
-                                                           {ShaderDataType::FLOAT2, "a_TextureCoord"},
-                                                           {ShaderDataType::FLOAT, "a_TilingFactor"},
-                                                           {ShaderDataType::FLOAT, "a_TextureIndex"}
-                                                   });
-            }
+        if(!instanced && s_Data.vertexFormat == Renderer2D::VertexFormat::FULL){
+            s_Data.quadVertexBuffer = createQuadStreamBuffer(s_Data.maxQuads * 4 * sizeof(QuadVertex));
+            s_Data.quadVertexBuffer->setLayout(s_QuadVertexLayout);
             s_Data.quadVertexArray->addVertexBuffer(s_Data.quadVertexBuffer);
-            s_Data.quadVertexBufferBase = new QuadVertex[s_Data.maxVertices];
         }
 
-        /* Create t he quad indices */
-        {
+        /* Create t he quad indices. Instanced quads share the indices of a single quad */
+        s_Data.quadVertexArray->setIndexBuffer(createQuadIndexBuffer(instanced ? 1 : s_Data.maxQuads));
 
+    }
 
-            auto *quadIndices = new uint32_t[s_Data.maxIndices];
+    /**
+     * \brief Gets the source of a Renderer2D shader built into the ShaderPreprocessor, so every application draws with
+     * the same shaders without shipping copies of them.
+     * @param name The name of the shader, such as Texture or TileMap
+     */
+    static std::string loadBuiltinShaderSource(const std::string& name, const ShaderDefines& defines){
 
-            uint32_t offset = 0;
-            for (uint32_t i = 0; i < s_Data.maxIndices; i += 6) {
-                quadIndices[i + 0] = offset + 0;
-                quadIndices[i + 1] = offset + 1;
-                quadIndices[i + 2] = offset + 2;
+        return ShaderPreprocessor::process("#include <GEOGL/Renderer2D/" + name + ".glsl>\n", ".", defines);
 
-                quadIndices[i + 3] = offset + 2;
-                quadIndices[i + 4] = offset + 3;
-                quadIndices[i + 5] = offset + 0;
+    }
 
-                offset += 4;
+    /**
+     * \brief Loads the built in texture shader called name, generating how it declares and samples its textures.
+     *
+     * With slots, GLSL 3.3 can only index a sampler array with a constant, so the fragment shader selects the texture
+     * with a switch, which has to have exactly one case per slot. Otherwise, the TextureTable generates the code.
+     * The code is generated after the ShaderPreprocessor has run, so an include can hold the tokens it replaces.
+     *
+     * A variant compiled with GEOGL_TEXTURED=0 has no samplers, so they are not set up.
+     */
+    static Ref<Shader> createTextureShader(const std::string& name, const Ref<TextureTable>& textureTable, const ShaderDefines& defines){
+        GEOGL_PROFILE_FUNCTION();
+
+        std::string source = loadBuiltinShaderSource(name, defines);
+
+        std::string version = "330 core";
+        std::string extensions;
+        std::string declarations;
+        std::string sampleCode;
+        if(textureTable){
+            version = textureTable->getShaderVersion();
+            extensions = textureTable->getShaderExtensions();
+            declarations = textureTable->getShaderDeclarations();
+            sampleCode = textureTable->getShaderSampleCode();
+        }else{
+            declarations = GEOGL_FORMAT("uniform sampler2D u_Textures[{}];", s_Data.maxTextureSlots);
+
+            sampleCode = "    switch(int(v_TextureIndex))\n    {\n";
+            for(uint32_t i = 0; i < s_Data.maxTextureSlots; ++i){
+                sampleCode += GEOGL_FORMAT("        case {0}: texColor *= texture(u_Textures[{0}], v_TextureCoord * v_TilingFactor); break;\n", i);
             }
+            sampleCode += "    }";
+        }
 
-            auto quadIB = IndexBuffer::create(quadIndices, s_Data.maxIndices);
-            s_Data.quadVertexArray->setIndexBuffer(quadIB);
-            delete[] quadIndices;
+        auto replaceAll = [&source](const std::string& token, const std::string& value){
+            for(size_t pos = source.find(token); pos != std::string::npos; pos = source.find(token, pos + value.size())){
+                source.replace(pos, token.size(), value);
+            }
+        };
+        replaceAll("#version 330 core", "#version " + version + (extensions.empty() ? "" : "\n" + extensions));
+        replaceAll("${TEXTURE_DECLARATIONS}", declarations);
+        replaceAll("${TEXTURE_SAMPLE}", sampleCode);
+
+        Ref<Shader> shader = Shader::createFromSource(source, name);
+
+        auto texturedDefine = defines.find("GEOGL_TEXTURED");
+        if(texturedDefine != defines.end() && texturedDefine->second == "0")
+            return shader;
+
+        /* Point the samplers at their slots */
+        if(textureTable){
+            textureTable->setUpShader(shader);
+        }else{
+            std::vector<int32_t> samplers(s_Data.maxTextureSlots);
+            for(uint32_t i = 0; i<s_Data.maxTextureSlots; ++i){
+                samplers[i] = (int32_t)i;
+            }
+            shader->setIntArray(s_TexturesUniform, samplers.data(), s_Data.maxTextureSlots);
         }
 
+        return shader;
+
+    }
+
+    /**
+     * \brief The defines the Renderer2D compiles its quad shaders with.
+     * @param textured Whether the variant samples textures, or only draws the vertex colors
+     */
+    static ShaderDefines getQuadShaderDefines(bool textured){
+
+        return {
+                {"GEOGL_MAX_TEXTURE_SLOTS", std::to_string(s_Data.maxTextureSlots)},
+                {"GEOGL_COMPACT_VERTICES", s_Data.vertexFormat == Renderer2D::VertexFormat::COMPACT ? "1" : "0"},
+                {"GEOGL_TEXTURED", textured ? "1" : "0"}
+        };
+
+    }
+
+    /**
+     * \brief Gets the shader for the current batch. A batch of untextured quads at most samples the white texture,
+     * so it is drawn with the color only variant, which skips the texture lookup, and the switch over every slot.
+     */
+    static const Ref<Shader>& getBatchShader(){
+
+        bool textured = s_Data.textureSlotIndex > 1 || (s_Data.textureSlotIndex == 1 && s_Data.textureSlots[0] != s_Data.whiteTexture);
+        if(textured)
+            return s_Data.textureShader;
+
+        if(!s_Data.colorShader)
+            s_Data.colorShader = createTextureShader(s_Data.textureShaderName, s_Data.textureTable, getQuadShaderDefines(false));
+
+        return s_Data.colorShader;
+
+    }
+
+    /**
+     * \brief Picks the TextureBinding to use, falling back towards slots if the requested one is unsupported.
+     */
+    static Renderer2D::TextureBinding selectTextureBinding(Renderer2D::TextureBinding requested){
+
+        using TextureBinding = Renderer2D::TextureBinding;
+
+        if(requested == TextureBinding::AUTOMATIC || requested == TextureBinding::BINDLESS){
+            if(TextureTable::isSupported(TextureTable::Type::BINDLESS))
+                return TextureBinding::BINDLESS;
+            if(requested == TextureBinding::AUTOMATIC)
+                return TextureBinding::SLOTS;
+            requested = TextureBinding::TEXTURE_ARRAYS;
+        }
+
+        if(requested == TextureBinding::TEXTURE_ARRAYS && TextureTable::isSupported(TextureTable::Type::TEXTURE_ARRAYS))
+            return TextureBinding::TEXTURE_ARRAYS;
+
+        return TextureBinding::SLOTS;
+
+    }
+
+    void GEOGL::Renderer2D::init(QuadMode quadMode) {
+
+        BatchProperties properties;
+        properties.quadMode = quadMode;
+        init(properties);
+
+    }
+
+    void GEOGL::Renderer2D::init(const BatchProperties& properties) {
+        GEOGL_PROFILE_FUNCTION();
+
+        const RenderCaps& caps = RenderCommand::getCapabilities();
+
+        s_Data.quadMode = properties.quadMode;
+        bool instanced = properties.quadMode == QuadMode::INSTANCED;
+
+        s_Data.vertexFormat = properties.vertexFormat;
+        if(instanced && properties.vertexFormat == VertexFormat::COMPACT){
+            GEOGL_CORE_WARN("The compact vertex format only applies to QuadMode::VERTICES. Using the full format.");
+            s_Data.vertexFormat = VertexFormat::FULL;
+        }
+
+        /* Use every texture unit the fragment shader has, unless asked for fewer */
+        s_Data.maxTextureSlots = caps.maxTextureImageUnits;
+        if(properties.maxTextureSlots)
+            s_Data.maxTextureSlots = std::min(properties.maxTextureSlots, caps.maxTextureImageUnits);
+        s_Data.maxTextureSlots = std::max(s_Data.maxTextureSlots, 1u);
+
+        /* The compact format has 16 bits of texture index, which holds the index of 32 units of texture arrays */
+        if(s_Data.vertexFormat == VertexFormat::COMPACT)
+            s_Data.maxTextureSlots = std::min(s_Data.maxTextureSlots, 32u);
+        s_Data.textureSlots.resize(s_Data.maxTextureSlots);
+
+        s_Data.textureBinding = selectTextureBinding(properties.textureBinding);
+        if(s_Data.textureBinding == TextureBinding::BINDLESS)
+            s_Data.textureTable = TextureTable::create(TextureTable::Type::BINDLESS, s_Data.maxTextureSlots);
+        else if(s_Data.textureBinding == TextureBinding::TEXTURE_ARRAYS)
+            s_Data.textureTable = TextureTable::create(TextureTable::Type::TEXTURE_ARRAYS, s_Data.maxTextureSlots);
+        else
+            s_Data.textureTable = nullptr;
+
+        s_Data.adaptiveBatchSize = properties.adaptiveBatchSize;
+        s_Data.pendingMaxQuads = 0;
+        createBatchBuffers(std::max(properties.maxQuads ? properties.maxQuads : s_DefaultMaxQuads, 1u));
+
+        static const char* textureBindingNames[] = {"automatic", "slots", "texture arrays", "bindless textures"};
+        GEOGL_CORE_INFO("Renderer2D batches {} quads with {} texture slots using {}{}", s_Data.maxQuads, s_Data.maxTextureSlots,
+                        textureBindingNames[(int)s_Data.textureBinding], s_Data.adaptiveBatchSize ? ", growing adaptively" : "");
+
         /* Creat eh the white texture */
         s_Data.whiteTexture = Texture2D::create(1,1);
         uint32_t whiteTextureData = 0xFFFFFFFF;
@@ -124,150 +523,295 @@ namespace GEOGL{
         s_Data.whiteTexture->setData(&whiteTextureData, sizeof(whiteTextureData));
 
         /* Create the shaders */
-        {
-            s_Data.textureShader = Shader::create(applicationResourceDirectory + "/Shaders/2DRenderer/Texture");
-            s_Data.textureShader->bind();
-
-            int32_t samplers[GEOGL::Renderer2DData::maxTextureSlots];
-            for(uint32_t i = 0; i<GEOGL::Renderer2DData::maxTextureSlots; ++i){
-                samplers[i] = (int32_t)i;
-                s_Data.textureShader->setInt(GEOGL_FORMAT("u_Textures[{}]", i).c_str(), i);
-            }
-            s_Data.textureShader->setIntArray("u_Textures", samplers, GEOGL::Renderer2DData::maxTextureSlots);
-        }
-
-        s_Data.quadVertexPositions[0] = {-0.5,  -0.5,   0.0f,   1.0f};
-        s_Data.quadVertexPositions[1] = { 0.5,  -0.5,   0.0f,   1.0f};
-        s_Data.quadVertexPositions[2] = { 0.5,   0.5,   0.0f,   1.0f};
-        s_Data.quadVertexPositions[3] = {-0.5,   0.5,   0.0f,   1.0f};
+        s_Data.textureShaderName = instanced ? "TextureInstanced" : "Texture";
+        s_Data.textureShader = createTextureShader(s_Data.textureShaderName, s_Data.textureTable, getQuadShaderDefines(true));
 
     }
 
     void GEOGL::Renderer2D::shutdown() {
         GEOGL_PROFILE_FUNCTION();
-        if(s_Data.quadVertexBufferBase)
-            delete s_Data.quadVertexBufferBase;
         s_Data.quadVertexBufferBase = nullptr;
         s_Data.quadVertexBufferPtr = nullptr;
+        s_Data.compactVertexBufferBase = nullptr;
+        s_Data.compactVertexBufferPtr = nullptr;
+        s_Data.quadInstanceBufferBase = nullptr;
+        s_Data.quadInstanceBufferPtr = nullptr;
 
         s_Data.quadVertexArray = nullptr;
         s_Data.quadVertexBuffer = nullptr;
 
-        for(uint32_t i=0; i<GEOGL::Renderer2DData::maxTextureSlots; ++i){
-            s_Data.textureSlots[i] = nullptr;
-        }
+        s_Data.textureSlots.clear();
+        s_Data.textureTable = nullptr;
 
         s_Data.whiteTexture = nullptr;
+        s_Data.quadTexturePalette.clear();
+        s_Data.textureSlotTable.clear();
+
+        s_Data.deferredQuads.clear();
+        s_Data.deferredQuads.shrink_to_fit();
+        s_Data.deferredSortEntries.clear();
+        s_Data.deferredSortEntries.shrink_to_fit();
+        s_Data.deferredSortScratch.clear();
+        s_Data.deferredSortScratch.shrink_to_fit();
+
+        s_Data.submittedContexts.clear();
+        s_Data.quadTexturePalette.shrink_to_fit();
 
         s_Data.textureShader = nullptr;
+        s_Data.colorShader = nullptr;
+        s_Data.staticBatchShader = nullptr;
+        s_Data.staticBatchIndexBuffer = nullptr;
+        s_Data.tileMapShader = nullptr;
+        s_Data.tileMapVertexArray = nullptr;
     }
 
     void GEOGL::Renderer2D::beginScene(const OrthographicCamera &camera) {
         GEOGL_PROFILE_FUNCTION();
 
-        auto projectionViewMatrix = camera.getProjectionViewMatrix();
+        /* Every Renderer2D shader reads the camera from the Camera block, so no shader is touched here */
+        Renderer::setCamera(camera.getProjectionViewMatrix());
 
-        s_Data.textureShader->bind();
-        s_Data.textureShader->setMat4("u_ProjectionViewMatrix", projectionViewMatrix);
+        if(s_Data.viewCulling){
+            OrthographicCamera::ProjectionBounds worldBounds = camera.calculateWorldBounds();
+            s_Data.viewBoundsMin = {worldBounds.left, worldBounds.bottom};
+            s_Data.viewBoundsMax = {worldBounds.right, worldBounds.top};
+        }else{
+            s_Data.viewBoundsMin = glm::vec2(-std::numeric_limits<float>::infinity());
+            s_Data.viewBoundsMax = glm::vec2(std::numeric_limits<float>::infinity());
+        }
 
-        s_Data.quadIndexCount = 0;
-        s_Data.quadVertexBufferPtr = s_Data.quadVertexBufferBase;
+        /* Grow the batch here rather than at endScene, as the buffers can only be replaced between batches */
+        if(s_Data.pendingMaxQuads){
+            GEOGL_CORE_INFO("Growing the Renderer2D batch from {} to {} quads", s_Data.maxQuads, s_Data.pendingMaxQuads);
+            createBatchBuffers(s_Data.pendingMaxQuads);
+            s_Data.pendingMaxQuads = 0;
+        }
 
-        s_Data.textureSlotIndex = 0;
+        s_Data.sceneQuadCount = 0;
+        s_Data.sceneCapacityFlushes = 0;
+
+        resetBatch();
 
     }
 
     void GEOGL::Renderer2D::endScene() {
         GEOGL_PROFILE_FUNCTION();
 
+        mergeRecordingContexts();
+        emitDeferredQuads();
         Renderer2D::flush();
+        s_Data.quadVertexBuffer->endFrame();
 
         if(s_Data.wireframe){
             Renderer2D::renderWireframe(false);
         }
 
+        /* The scene did not fit in one batch, so grow to the next power of two that would have held it */
+        if(s_Data.adaptiveBatchSize && s_Data.sceneCapacityFlushes && s_Data.maxQuads < s_MaxAdaptiveQuads){
+            uint32_t maxQuads = s_Data.maxQuads;
+            while(maxQuads < s_Data.sceneQuadCount && maxQuads < s_MaxAdaptiveQuads)
+                maxQuads *= 2;
+
+            s_Data.pendingMaxQuads = std::min(maxQuads, s_MaxAdaptiveQuads);
+        }
+
     }
 
     void GEOGL::Renderer2D::flush(){
         GEOGL_PROFILE_FUNCTION();
 
-        if(s_Data.quadVertexBufferPtr == s_Data.quadVertexBufferBase) return; /* Since there is no data to render, skip the remainder of the function */
+        if(s_Data.quadIndexCount == 0) return; /* Since there is no data to render, skip the remainder of the function */
 
-        s_Data.textureShader->bind();
+        const Ref<Shader>& shader = getBatchShader();
+        shader->bind();
         s_Data.quadVertexArray->bind();
 
-        //s_Data.textureSlots[0]->bind(0);
-        //s_Data.textureSlots[1]->bind(1);
-
-        for(uint32_t i=0; i<s_Data.textureSlotIndex; ++i){
-            auto& texture = s_Data.textureSlots[i];
-            texture->bind(i);
+        /* The color only shader samples nothing, so there is nothing to bind for it */
+        if(shader != s_Data.colorShader){
+            if(s_Data.textureTable){
+                s_Data.textureTable->bind();
+            }else{
+                for(uint32_t i=0; i<s_Data.textureSlotIndex; ++i){
+                    auto& texture = s_Data.textureSlots[i];
+                    texture->bind(i);
+                }
+            }
         }
 
-        uint32_t dataSize = (uint8_t*)s_Data.quadVertexBufferPtr - (uint8_t*)s_Data.quadVertexBufferBase;
-        s_Data.quadVertexBuffer->setData(s_Data.quadVertexBufferBase, dataSize);
+        /* The batch was written straight into the stream buffer, so it only needs committing before drawing */
+        if(s_Data.quadMode == QuadMode::INSTANCED){
+            uint32_t dataSize = (uint8_t*)s_Data.quadInstanceBufferPtr - (uint8_t*)s_Data.quadInstanceBufferBase;
+            uint32_t offset = s_Data.quadVertexBuffer->commit(dataSize);
 
-        RenderCommand::drawIndexed(s_Data.quadVertexArray, s_Data.quadIndexCount);
-        s_Data.stats.drawCalls++;
+            RenderCommand::drawIndexedInstanced(s_Data.quadVertexArray, 6, s_Data.quadIndexCount / 6, offset / sizeof(QuadInstanceVertex));
+        }else if(s_Data.vertexFormat == VertexFormat::COMPACT){
+            uint32_t dataSize = (uint8_t*)s_Data.compactVertexBufferPtr - (uint8_t*)s_Data.compactVertexBufferBase;
+            uint32_t offset = s_Data.quadVertexBuffer->commit(dataSize);
 
-        s_Data.quadIndexCount = 0;
-        s_Data.quadVertexBufferPtr = s_Data.quadVertexBufferBase;
+            RenderCommand::drawIndexed(s_Data.quadVertexArray, s_Data.quadIndexCount, offset / sizeof(CompactQuadVertex));
+        }else{
+            uint32_t dataSize = (uint8_t*)s_Data.quadVertexBufferPtr - (uint8_t*)s_Data.quadVertexBufferBase;
+            uint32_t offset = s_Data.quadVertexBuffer->commit(dataSize);
 
-        s_Data.textureSlotIndex = 0;
+            RenderCommand::drawIndexed(s_Data.quadVertexArray, s_Data.quadIndexCount, offset / sizeof(QuadVertex));
+        }
+        s_Data.stats.drawCalls++;
+        s_Data.sceneQuadCount += s_Data.quadIndexCount / 6;
+
+        s_Data.quadVertexBuffer->advance();
+        resetBatch();
 
     }
 
     void Renderer2D::renderWireframe(bool status) {
 
+        emitDeferredQuads();
         Renderer2D::flush();
         RenderCommand::renderWireframe(&status);
         s_Data.wireframe = status;
 
     }
 
-    void GEOGL::Renderer2D::drawQuad(const QuadProperties& properties) {
+    /**
+     * \brief Finds the slot the texture is bound to in the current batch.
+     * @return The slot, or -1 if the texture is not yet in the batch.
+     */
+    static inline float findTextureSlot(TextureHandle texture){
 
-        drawQuad(properties, s_Data.whiteTexture);
+        if(texture.rendererID < s_Data.textureSlotTable.size()){
+            const TextureSlotEntry& entry = s_Data.textureSlotTable[texture.rendererID];
+            if(entry.batchStamp == s_Data.batchStamp && entry.generation == texture.generation)
+                return entry.textureIndex;
+        }
+
+        return -1;
 
     }
 
-    void Renderer2D::drawQuad(const QuadProperties& properties, const Ref<Texture2D>& texture) {
-        GEOGL_RENDERER_PROFILE_FUNCTION();
+    /**
+     * \brief Adds a texture to the next free slot of the batch, pinning it until the slot is reused.
+     * @return The slot, or -1 if the batch has no room for another texture.
+     */
+    static float addTextureSlot(TextureHandle texture){
+
+        Ref<Texture2D> pinnedTexture = Texture2D::resolve(texture);
+        GEOGL_CORE_ASSERT(pinnedTexture, "Tried to draw with texture {}, which has already been destroyed.", texture.rendererID);
+        if(!pinnedTexture){
+            pinnedTexture = s_Data.whiteTexture;
+            texture = pinnedTexture->getHandle();
+
+            float textureIndex = findTextureSlot(texture);
+            if(textureIndex >= 0)
+                return textureIndex;
+        }
 
-        /* guard against buffer overflow */
-        if(s_Data.quadIndexCount >= s_Data.maxIndices || s_Data.textureSlotIndex >= GEOGL::Renderer2DData::maxTextureSlots){
-            flush();
+        float textureIndex;
+        if(s_Data.textureTable){
+            int32_t tableIndex = s_Data.textureTable->add(pinnedTexture);
+            if(tableIndex < 0)
+                return -1;
+            textureIndex = (float)tableIndex;
+        }else{
+            if(s_Data.textureSlotIndex >= s_Data.maxTextureSlots)
+                return -1;
+            textureIndex = (float)s_Data.textureSlotIndex;
         }
 
-        glm::mat4 transform = glm::translate(s_IdentMatrix, properties.position);
-        transform = glm::scale(transform, {properties.size.x, properties.size.y, 1.0f});
+        /* A texture table holds more textures than there are slots, so the pins grow to match */
+        if(s_Data.textureSlotIndex < s_Data.textureSlots.size())
+            s_Data.textureSlots[s_Data.textureSlotIndex] = std::move(pinnedTexture);
+        else
+            s_Data.textureSlots.push_back(std::move(pinnedTexture));
+        ++s_Data.textureSlotIndex;
 
-        glm::vec3 position = properties.position;
+        if(texture.rendererID >= s_Data.textureSlotTable.size())
+            s_Data.textureSlotTable.resize(texture.rendererID + 1);
+        s_Data.textureSlotTable[texture.rendererID] = {s_Data.batchStamp, texture.generation, textureIndex};
 
-        float textureIndex = -1;
+        return textureIndex;
 
-        for(uint32_t i=0; i<s_Data.textureSlotIndex;++i){
-            if(*s_Data.textureSlots[i] == *texture){
-                textureIndex = (float)i;
-                break;
-            }
+    }
+
+    /**
+     * \brief Finds the slot the texture is bound to in the current batch, adding it if it is not yet in one.
+     * @return The slot, or -1 if the batch has no room for another texture.
+     */
+    static inline float getTextureIndex(TextureHandle texture){
+
+        float textureIndex = findTextureSlot(texture);
+        return textureIndex >= 0 ? textureIndex : addTextureSlot(texture);
+
+    }
+
+    /**
+     * \brief Flushes a batch that ran out of room for quads, counting it towards adaptive batch sizing.
+     */
+    static inline void flushFullBatch(){
+
+        ++s_Data.sceneCapacityFlushes;
+        Renderer2D::flush();
+
+    }
+
+    /**
+     * \brief Fills in everything but the positions of the four vertices of a quad.
+     */
+    static inline void writeQuadAttributes(QuadVertex* vertex, const glm::vec4& colorTint, const glm::vec2* textureCoords, float tilingFactor, float textureIndex){
+
+        for(int corner = 0; corner < 4; ++corner){
+            vertex->color = colorTint;
+            vertex->textureCoord = textureCoords[corner];
+            vertex->tilingFactor = tilingFactor;
+            vertex->textureIndex = (uint32_t)textureIndex;
+            ++vertex;
         }
 
-        if(textureIndex==-1){
-            textureIndex = (float)s_Data.textureSlotIndex;
-            s_Data.textureSlots[s_Data.textureSlotIndex] = texture;
-            ++s_Data.textureSlotIndex;
+    }
+
+    static inline void writeQuadAttributes(CompactQuadVertex* vertex, const glm::vec4& colorTint, const glm::vec2* textureCoords, float tilingFactor, float textureIndex){
+
+        /* Pack once per quad rather than once per vertex */
+        uint32_t color = glm::packUnorm4x8(colorTint);
+        uint16_t packedTilingFactor = glm::packHalf1x16(tilingFactor);
+        auto packedTextureIndex = (uint16_t)textureIndex;
+
+        for(int corner = 0; corner < 4; ++corner){
+            vertex->color = color;
+            vertex->textureCoord = glm::packUnorm2x16(textureCoords[corner]);
+            vertex->tilingFactor = packedTilingFactor;
+            vertex->textureIndex = packedTextureIndex;
+            ++vertex;
+        }
+
+    }
+
+    /**
+     * \brief Writes a single quad into the batch, flushing first if the batch is full.
+     */
+    static void writeQuad(const Quad2DTransform& transform, const glm::vec4& colorTint, float tilingFactor, TextureHandle texture, const glm::vec2* textureCoords){
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        /* guard against buffer overflow */
+        if(s_Data.quadIndexCount >= s_Data.maxIndices){
+            flushFullBatch();
         }
 
-        glm::vec2 textureCoords[] = {{0,0}, {1,0}, {1,1}, {0,1}};
+        float textureIndex = getTextureIndex(texture);
+        if(textureIndex < 0){
+            Renderer2D::flush();
+            textureIndex = getTextureIndex(texture);
+        }
 
-        for(int i=0; i<4; ++i){
-            s_Data.quadVertexBufferPtr->position = transform * s_Data.quadVertexPositions[i];
-            s_Data.quadVertexBufferPtr->color = properties.colorTint;
-            s_Data.quadVertexBufferPtr->textureCoord = textureCoords[i];
-            s_Data.quadVertexBufferPtr->tilingFactor = properties.tilingFactor;
-            s_Data.quadVertexBufferPtr->textureIndex = textureIndex;
-            s_Data.quadVertexBufferPtr++;
+        if(s_Data.quadMode == Renderer2D::QuadMode::INSTANCED){
+            *s_Data.quadInstanceBufferPtr++ = {transform, colorTint, {textureCoords[0], textureCoords[2]}, tilingFactor, textureIndex};
+        }else if(s_Data.vertexFormat == Renderer2D::VertexFormat::COMPACT){
+            QuadVertexKernel::generateCorners(&transform, 1, &s_Data.compactVertexBufferPtr->position, sizeof(CompactQuadVertex));
+            writeQuadAttributes(s_Data.compactVertexBufferPtr, colorTint, textureCoords, tilingFactor, textureIndex);
+            s_Data.compactVertexBufferPtr += 4;
+        }else{
+            QuadVertexKernel::generateCorners(&transform, 1, &s_Data.quadVertexBufferPtr->position, sizeof(QuadVertex));
+            writeQuadAttributes(s_Data.quadVertexBufferPtr, colorTint, textureCoords, tilingFactor, textureIndex);
+            s_Data.quadVertexBufferPtr += 4;
         }
 
         s_Data.quadIndexCount += 6;
@@ -276,51 +820,273 @@ namespace GEOGL{
 
     }
 
-    void Renderer2D::drawQuad(const Renderer2D::QuadProperties &properties, const Ref <SubTexture2D> &subTexture) {
+    /**
+     * \brief Builds the sort key of a deferred quad.
+     *
+     * From the most significant bit: 1 bit translucency, so opaque quads come first, 24 bits of depth, and 16 bits of
+     * texture, so quads at the same depth are grouped by texture. The low 23 bits are reserved for the blend mode and
+     * shader, as the Renderer2D currently only has one of each.
+     *
+     * A larger z is closer to the camera, so the depth of opaque quads is inverted to draw them front to back, while
+     * translucent quads are drawn back to front.
+     */
+    static inline uint64_t makeSortKey(float z, bool translucent, TextureHandle texture){
 
+        uint64_t depth = RadixSort::floatToSortable(z) >> 8;
+        if(!translucent)
+            depth = ~depth & 0xFFFFFF;
+
+        return ((uint64_t)translucent << 63) | (depth << 39) | ((uint64_t)(texture.rendererID & 0xFFFF) << 23);
+
+    }
+
+    static void recordQuad(const Quad2DTransform& transform, const glm::vec4& colorTint, float tilingFactor, TextureHandle texture, const glm::vec2* textureCoords){
+
+        /* Textures may have transparent texels, so only untextured quads with an opaque tint are known to be opaque */
+        bool translucent = colorTint.a < 1.0f || texture != s_Data.whiteTexture->getHandle();
+
+        auto index = (uint32_t)s_Data.deferredQuads.size();
+        s_Data.deferredQuads.push_back({transform, colorTint, {textureCoords[0], textureCoords[2]}, tilingFactor, texture});
+        s_Data.deferredSortEntries.push_back({makeSortKey(transform.position.z, translucent, texture), index});
+
+    }
+
+    /**
+     * \brief Sorts the quads recorded since the last emit, and writes them into batches in that order.
+     */
+    static void emitDeferredQuads(){
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        auto texture = subTexture->getTexture();
+        if(s_Data.deferredSortEntries.empty())
+            return;
 
-        /* guard against buffer overflow */
-        if(s_Data.quadIndexCount >= s_Data.maxIndices || s_Data.textureSlotIndex >= GEOGL::Renderer2DData::maxTextureSlots){
-            flush();
+        RadixSort::sort(s_Data.deferredSortEntries, s_Data.deferredSortScratch);
+
+        for(const auto& entry : s_Data.deferredSortEntries){
+            const Renderer2D::RecordedQuad& quad = s_Data.deferredQuads[entry.index];
+            const glm::vec4& rect = quad.textureRect;
+            const glm::vec2 textureCoords[4] = {{rect.x, rect.y}, {rect.z, rect.y}, {rect.z, rect.w}, {rect.x, rect.w}};
+
+            writeQuad(quad.transform, quad.colorTint, quad.tilingFactor, quad.texture, textureCoords);
         }
 
-        glm::mat4 transform = glm::translate(s_IdentMatrix, properties.position);
-        transform = glm::scale(transform, {properties.size.x, properties.size.y, 1.0f});
+        s_Data.deferredQuads.clear();
+        s_Data.deferredSortEntries.clear();
 
-        glm::vec3 position = properties.position;
+    }
 
-        float textureIndex = -1;
+    /**
+     * \brief Writes a single quad into the batch, or records it to be sorted in SubmissionMode::DEFERRED, unless it is
+     * outside of the view.
+     */
+    static inline void submitQuad(const Quad2DTransform& transform, const glm::vec4& colorTint, float tilingFactor, TextureHandle texture, const glm::vec2* textureCoords){
 
-        for(uint32_t i=0; i<s_Data.textureSlotIndex;++i){
-            if(*s_Data.textureSlots[i] == *texture){
-                textureIndex = (float)i;
-                break;
-            }
+        if(!transform.overlaps(s_Data.viewBoundsMin, s_Data.viewBoundsMax)){
+            ++s_Data.stats.culledQuadCount;
+            return;
         }
 
-        if(textureIndex==-1){
-            textureIndex = (float)s_Data.textureSlotIndex;
-            s_Data.textureSlots[s_Data.textureSlotIndex] = texture;
-            ++s_Data.textureSlotIndex;
+        if(s_Data.submissionMode == Renderer2D::SubmissionMode::DEFERRED)
+            recordQuad(transform, colorTint, tilingFactor, texture, textureCoords);
+        else
+            writeQuad(transform, colorTint, tilingFactor, texture, textureCoords);
+
+    }
+
+    /**
+     * \brief The vertex formats a RecordingContext can be finished in, one per way the batch can be written.
+     */
+    enum class FinishedVertexFormat : uint32_t{
+        NONE = 0,
+        FULL,
+        COMPACT,
+        INSTANCED
+    };
+
+    static inline FinishedVertexFormat getFinishedVertexFormat(){
+
+        if(s_Data.quadMode == Renderer2D::QuadMode::INSTANCED)
+            return FinishedVertexFormat::INSTANCED;
+
+        return s_Data.vertexFormat == Renderer2D::VertexFormat::COMPACT ? FinishedVertexFormat::COMPACT : FinishedVertexFormat::FULL;
+
+    }
+
+    /**
+     * \brief Gets the bytes a quad takes up in a vertex stream of the given format.
+     */
+    static inline size_t getFinishedQuadSize(FinishedVertexFormat format){
+
+        switch(format){
+            case FinishedVertexFormat::FULL:
+                return 4 * sizeof(QuadVertex);
+            case FinishedVertexFormat::COMPACT:
+                return 4 * sizeof(CompactQuadVertex);
+            case FinishedVertexFormat::INSTANCED:
+                return sizeof(QuadInstanceVertex);
+            default:
+                return 0;
         }
 
-        auto textureCoords = subTexture->getTextureCoords();
+    }
 
-        for(int i=0; i<4; ++i){
-            s_Data.quadVertexBufferPtr->position = transform * s_Data.quadVertexPositions[i];
-            s_Data.quadVertexBufferPtr->color = properties.colorTint;
-            s_Data.quadVertexBufferPtr->textureCoord = textureCoords[i];
-            s_Data.quadVertexBufferPtr->tilingFactor = properties.tilingFactor;
-            s_Data.quadVertexBufferPtr->textureIndex = textureIndex;
-            s_Data.quadVertexBufferPtr++;
+    /**
+     * \brief Copies finished vertices into the batch, replacing the texture index each one was finished with by the
+     * index the batch has for that texture. Each vertex is written whole, as the batch may be write combined memory.
+     */
+    template<typename Vertex>
+    static void copyFinishedVertices(Vertex*& bufferPtr, const uint8_t* source, size_t vertexCount, const float* textureIndices, bool renumber){
+
+        const auto* sourceVertex = reinterpret_cast<const Vertex*>(source);
+        if(!renumber){
+            memcpy(bufferPtr, sourceVertex, vertexCount * sizeof(Vertex));
+            bufferPtr += vertexCount;
+            return;
         }
 
-        s_Data.quadIndexCount += 6;
+        for(size_t i = 0; i < vertexCount; ++i){
+            Vertex vertex = sourceVertex[i];
+            vertex.textureIndex = (decltype(vertex.textureIndex)) textureIndices[(size_t) vertex.textureIndex];
+            *bufferPtr++ = vertex;
+        }
 
-        ++s_Data.stats.quadCount;
+    }
+
+    void Renderer2D::mergeRecordingContexts(){
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        if(s_Data.submittedContexts.empty())
+            return;
+
+        /* Stable, so contexts with the same merge order keep the order they were submitted in */
+        std::stable_sort(s_Data.submittedContexts.begin(), s_Data.submittedContexts.end(), [](const SubmittedContext& a, const SubmittedContext& b){
+            return a.mergeOrder < b.mergeOrder;
+        });
+
+        TextureHandle whiteTexture = s_Data.whiteTexture->getHandle();
+        FinishedVertexFormat vertexFormat = getFinishedVertexFormat();
+        size_t quadSize = getFinishedQuadSize(vertexFormat);
+
+        /* Writes quads one at a time, for the quads of a context that can not be copied */
+        auto writeRecordedQuads = [whiteTexture](const RecordingContext& context, uint32_t first, uint32_t end, bool deferred){
+            for(uint32_t i = first; i < end; ++i){
+                const RecordedQuad& quad = context.m_Quads[i];
+                const glm::vec4& rect = quad.textureRect;
+                const glm::vec2 textureCoords[4] = {{rect.x, rect.y}, {rect.z, rect.y}, {rect.z, rect.w}, {rect.x, rect.w}};
+                TextureHandle texture = quad.texture.isValid() ? quad.texture : whiteTexture;
+
+                if(deferred)
+                    submitQuad(quad.transform, quad.colorTint, quad.tilingFactor, texture, textureCoords);
+                else
+                    writeQuad(quad.transform, quad.colorTint, quad.tilingFactor, texture, textureCoords);
+            }
+        };
+
+        /* Finds the index the batch has for each texture of a segment, adding the ones it does not have yet */
+        auto resolveSegmentTextures = [](const TextureHandle* textures, uint32_t textureCount, bool& renumber){
+            renumber = false;
+            for(uint32_t i = 0; i < textureCount; ++i){
+                float textureIndex = getTextureIndex(textures[i]);
+                if(textureIndex < 0)
+                    return false;
+
+                s_Data.segmentTextureIndices[i] = textureIndex;
+                renumber |= textureIndex != (float)i;
+            }
+            return true;
+        };
+
+        for(const auto& submittedContext : s_Data.submittedContexts){
+            RecordingContext& context = *submittedContext.context;
+
+            /* Deferred quads are sorted with the rest of the scene, so the finished order can not be kept */
+            if(s_Data.submissionMode == SubmissionMode::DEFERRED){
+                writeRecordedQuads(context, 0, (uint32_t)context.m_Quads.size(), true);
+                continue;
+            }
+
+            if(!context.m_Finished || context.m_VertexFormatKey != (uint32_t)vertexFormat)
+                context.finish();
+
+            for(const auto& segment : context.m_Segments){
+
+                if(segment.boundsMax.x < s_Data.viewBoundsMin.x || segment.boundsMin.x > s_Data.viewBoundsMax.x ||
+                   segment.boundsMax.y < s_Data.viewBoundsMin.y || segment.boundsMin.y > s_Data.viewBoundsMax.y){
+                    s_Data.stats.culledQuadCount += segment.quadCount;
+                    continue;
+                }
+
+                const TextureHandle* textures = context.m_SegmentTextures.data() + segment.firstTexture;
+                if(s_Data.segmentTextureIndices.size() < segment.textureCount)
+                    s_Data.segmentTextureIndices.resize(segment.textureCount);
+
+                uint32_t quad = segment.firstQuad;
+                uint32_t end = segment.firstQuad + segment.quadCount;
+                while(quad < end){
+
+                    if(s_Data.quadIndexCount >= s_Data.maxIndices){
+                        flushFullBatch();
+                    }
+
+                    /* A segment never has more textures than there are slots, so an empty batch always fits them,
+                     * unless a TextureTable runs out of room first */
+                    bool renumber;
+                    if(!resolveSegmentTextures(textures, segment.textureCount, renumber)){
+                        Renderer2D::flush();
+                        if(!resolveSegmentTextures(textures, segment.textureCount, renumber)){
+                            writeRecordedQuads(context, quad, end, false);
+                            break;
+                        }
+                    }
+
+                    uint32_t count = std::min(end - quad, (s_Data.maxIndices - s_Data.quadIndexCount) / 6);
+                    const uint8_t* source = context.m_Vertices.data() + quad * quadSize;
+                    const float* textureIndices = s_Data.segmentTextureIndices.data();
+
+                    switch(vertexFormat){
+                        case FinishedVertexFormat::INSTANCED:
+                            copyFinishedVertices(s_Data.quadInstanceBufferPtr, source, count, textureIndices, renumber);
+                            break;
+                        case FinishedVertexFormat::COMPACT:
+                            copyFinishedVertices(s_Data.compactVertexBufferPtr, source, count * 4, textureIndices, renumber);
+                            break;
+                        default:
+                            copyFinishedVertices(s_Data.quadVertexBufferPtr, source, count * 4, textureIndices, renumber);
+                            break;
+                    }
+
+                    s_Data.quadIndexCount += count * 6;
+                    s_Data.stats.quadCount += count;
+                    quad += count;
+                }
+            }
+        }
+
+        s_Data.submittedContexts.clear();
+
+    }
+
+    void GEOGL::Renderer2D::drawQuad(const QuadProperties& properties) {
+
+        drawQuad(properties, s_Data.whiteTexture);
+
+    }
+
+    void Renderer2D::drawQuad(const QuadProperties& properties, const Ref<Texture2D>& texture) {
+
+        submitQuad({properties.position, properties.size}, properties.colorTint, properties.tilingFactor, texture->getHandle(), s_TextureCoords);
+
+    }
+
+    void Renderer2D::drawQuad(const QuadProperties& properties, TextureHandle texture) {
+
+        submitQuad({properties.position, properties.size}, properties.colorTint, properties.tilingFactor, texture, s_TextureCoords);
+
+    }
+
+    void Renderer2D::drawQuad(const Renderer2D::QuadProperties &properties, const Ref <SubTexture2D> &subTexture) {
+
+        submitQuad({properties.position, properties.size}, properties.colorTint, properties.tilingFactor, subTexture->getTexture()->getHandle(), subTexture->getTextureCoords());
 
     }
 
@@ -331,101 +1097,583 @@ namespace GEOGL{
     }
 
     void Renderer2D::drawRotatedQuad(const Renderer2D::QuadProperties &properties, const Ref <Texture2D> &texture, float rotation) {
+
+        submitQuad(Quad2DTransform::fromRotation(properties.position, properties.size, rotation), properties.colorTint, properties.tilingFactor, texture->getHandle(), s_TextureCoords);
+
+    }
+
+    void Renderer2D::drawRotatedQuad(const Renderer2D::QuadProperties &properties, TextureHandle texture, float rotation) {
+
+        submitQuad(Quad2DTransform::fromRotation(properties.position, properties.size, rotation), properties.colorTint, properties.tilingFactor, texture, s_TextureCoords);
+
+    }
+
+    void Renderer2D::drawRotatedQuad(const Renderer2D::QuadProperties &properties, const Ref <SubTexture2D> &subTexture, float rotation) {
+
+        submitQuad(Quad2DTransform::fromRotation(properties.position, properties.size, rotation), properties.colorTint, properties.tilingFactor, subTexture->getTexture()->getHandle(), subTexture->getTextureCoords());
+
+    }
+
+    /**
+     * \brief Reads quads out of an array of QuadInstance for submitQuads.
+     */
+    struct QuadInstanceSource{
+        const Renderer2D::QuadInstance* quads;
+
+        inline Quad2DTransform getTransform(size_t i) const { return Quad2DTransform::fromRotation(quads[i].position, quads[i].size, quads[i].rotation); };
+        inline const glm::vec4& getColorTint(size_t i) const { return quads[i].colorTint; };
+        inline float getTilingFactor(size_t i) const { return quads[i].tilingFactor; };
+        inline uint32_t getTextureIndex(size_t i) const { return quads[i].textureIndex; };
+    };
+
+    /**
+     * \brief Reads quads out of a QuadArrays for submitQuads, substituting the QuadInstance defaults for missing arrays.
+     */
+    struct QuadArraysSource{
+        const Renderer2D::QuadArrays& quads;
+
+        inline Quad2DTransform getTransform(size_t i) const {
+            return quads.rotations ? Quad2DTransform::fromRotation(quads.positions[i], quads.sizes[i], quads.rotations[i]) : Quad2DTransform(quads.positions[i], quads.sizes[i]);
+        };
+        inline const glm::vec4& getColorTint(size_t i) const { return quads.colorTints ? quads.colorTints[i] : s_WhiteColor; };
+        inline float getTilingFactor(size_t i) const { return quads.tilingFactors ? quads.tilingFactors[i] : 1.0f; };
+        inline uint32_t getTextureIndex(size_t i) const { return quads.textureIndices ? quads.textureIndices[i] : 0; };
+    };
+
+    /**
+     * \brief Writes count quads into the batch in chunks, flushing only when the vertex buffer or texture slots run out.
+     * Quads outside of the view are skipped before their vertices are generated.
+     *
+     * When singleTexture is set, every quad uses palette[0] and the per quad texture indices are never read.
+     */
+    template<typename QuadSource>
+    static void submitQuads(const QuadSource& source, size_t count, const QuadTexture* palette, size_t paletteSize, bool singleTexture){
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* guard against buffer overflow */
-        if(s_Data.quadIndexCount >= s_Data.maxIndices || s_Data.textureSlotIndex >= GEOGL::Renderer2DData::maxTextureSlots){
-            flush();
+        if(s_Data.submissionMode == Renderer2D::SubmissionMode::DEFERRED){
+            for(size_t quad = 0; quad < count; ++quad){
+                Quad2DTransform transform = source.getTransform(quad);
+                if(!transform.overlaps(s_Data.viewBoundsMin, s_Data.viewBoundsMax)){
+                    ++s_Data.stats.culledQuadCount;
+                    continue;
+                }
+
+                uint32_t paletteIndex = singleTexture ? 0 : source.getTextureIndex(quad);
+                GEOGL_CORE_ASSERT(paletteIndex < paletteSize, "Tried to draw a quad with texture {}, but the palette only has {} textures.", paletteIndex, paletteSize);
+
+                recordQuad(transform, source.getColorTint(quad), source.getTilingFactor(quad), palette[paletteIndex].texture, palette[paletteIndex].textureCoords);
+            }
+            return;
         }
 
-        glm::mat4 transform = glm::translate(s_IdentMatrix, properties.position);
-        transform = (rotation!=0) ? glm::rotate(transform, (rotation), {0,0,1}) : transform;
-        transform = glm::scale(transform, {properties.size.x, properties.size.y, 1.0f});
+        constexpr size_t chunkSize = 128;
+        Quad2DTransform transforms[chunkSize];
+        size_t sourceIndices[chunkSize];
+        float textureIndices[chunkSize];
+        const glm::vec2* textureCoords[chunkSize];
 
-        glm::vec3 position = properties.position;
+        size_t quad = 0;
+        while(quad < count){
 
-        float textureIndex = -1;
+            if(s_Data.quadIndexCount >= s_Data.maxIndices){
+                flushFullBatch();
+            }
 
-        for(uint32_t i=0; i<s_Data.textureSlotIndex;++i){
-            if(*s_Data.textureSlots[i] == *texture){
-                textureIndex = (float)i;
-                break;
+            size_t freeQuads = (s_Data.maxIndices - s_Data.quadIndexCount) / 6;
+            size_t chunk = std::min(freeQuads, chunkSize);
+
+            /* Cull the quads and resolve the textures of the visible ones before generating any vertices, ending the
+             * chunk early if a texture needs a slot and none are left */
+            size_t resolved = 0;
+            bool outOfTextures = false;
+            while(resolved < chunk && quad < count){
+                Quad2DTransform transform = source.getTransform(quad);
+                if(!transform.overlaps(s_Data.viewBoundsMin, s_Data.viewBoundsMax)){
+                    ++s_Data.stats.culledQuadCount;
+                    ++quad;
+                    continue;
+                }
+
+                uint32_t paletteIndex = singleTexture ? 0 : source.getTextureIndex(quad);
+                GEOGL_CORE_ASSERT(paletteIndex < paletteSize, "Tried to draw a quad with texture {}, but the palette only has {} textures.", paletteIndex, paletteSize);
+
+                const QuadTexture& texture = palette[paletteIndex];
+                float textureIndex = findTextureSlot(texture.texture);
+                if(textureIndex < 0){
+                    textureIndex = addTextureSlot(texture.texture);
+                    if(textureIndex < 0){
+                        outOfTextures = true;
+                        break;
+                    }
+                }
+
+                transforms[resolved] = transform;
+                sourceIndices[resolved] = quad;
+                textureIndices[resolved] = textureIndex;
+                textureCoords[resolved] = texture.textureCoords;
+                ++resolved;
+                ++quad;
             }
-        }
 
-        if(textureIndex==-1){
-            textureIndex = (float)s_Data.textureSlotIndex;
-            s_Data.textureSlots[s_Data.textureSlotIndex] = texture;
-            ++s_Data.textureSlotIndex;
+            if(resolved == 0){
+                if(outOfTextures)
+                    Renderer2D::flush();
+                continue;
+            }
+
+            if(s_Data.quadMode == Renderer2D::QuadMode::INSTANCED){
+                QuadInstanceVertex* instance = s_Data.quadInstanceBufferPtr;
+
+                for(size_t i = 0; i < resolved; ++i){
+                    *instance++ = {transforms[i], source.getColorTint(sourceIndices[i]), {textureCoords[i][0], textureCoords[i][2]},
+                                   source.getTilingFactor(sourceIndices[i]), textureIndices[i]};
+                }
+
+                s_Data.quadInstanceBufferPtr = instance;
+            }else{
+                /* Both vertex formats are written the same way, only the attribute packing differs */
+                auto writeVertices = [&](auto*& bufferPtr){
+                    auto* vertex = bufferPtr;
+                    QuadVertexKernel::generateCorners(transforms, resolved, &vertex->position, sizeof(*vertex));
+
+                    for(size_t i = 0; i < resolved; ++i){
+                        writeQuadAttributes(vertex, source.getColorTint(sourceIndices[i]), textureCoords[i], source.getTilingFactor(sourceIndices[i]), textureIndices[i]);
+                        vertex += 4;
+                    }
+
+                    bufferPtr = vertex;
+                };
+
+                if(s_Data.vertexFormat == Renderer2D::VertexFormat::COMPACT)
+                    writeVertices(s_Data.compactVertexBufferPtr);
+                else
+                    writeVertices(s_Data.quadVertexBufferPtr);
+            }
+            s_Data.quadIndexCount += (uint32_t)resolved * 6;
+            s_Data.stats.quadCount += (uint32_t)resolved;
+
         }
 
-        glm::vec2 textureCoords[] = {{0,0}, {1,0}, {1,1}, {0,1}};
+    }
+
+    /**
+     * \brief Fills the palette scratch storage from an array of subtextures.
+     */
+    static QuadTexture* buildQuadTexturePalette(const Ref<SubTexture2D>* textures, size_t textureCount){
 
-        for(int i=0; i<4; ++i){
-            s_Data.quadVertexBufferPtr->position = transform * s_Data.quadVertexPositions[i];
-            s_Data.quadVertexBufferPtr->color = properties.colorTint;
-            s_Data.quadVertexBufferPtr->textureCoord = textureCoords[i];
-            s_Data.quadVertexBufferPtr->tilingFactor = properties.tilingFactor;
-            s_Data.quadVertexBufferPtr->textureIndex = textureIndex;
-            s_Data.quadVertexBufferPtr++;
+        s_Data.quadTexturePalette.resize(textureCount);
+        for(size_t i = 0; i < textureCount; ++i){
+            s_Data.quadTexturePalette[i] = {textures[i]->getTexture()->getHandle(), textures[i]->getTextureCoords()};
         }
 
+        return s_Data.quadTexturePalette.data();
 
-        s_Data.quadIndexCount += 6;
+    }
 
-        ++s_Data.stats.quadCount;
+    void Renderer2D::drawQuads(const QuadInstance* begin, size_t count) {
+
+        drawQuads(begin, count, s_Data.whiteTexture);
 
     }
 
+    void Renderer2D::drawQuads(const QuadInstance* begin, size_t count, const Ref<Texture2D>& texture) {
 
+        QuadTexture palette = {texture->getHandle(), s_TextureCoords};
+        submitQuads(QuadInstanceSource{begin}, count, &palette, 1, true);
 
-    void Renderer2D::drawRotatedQuad(const Renderer2D::QuadProperties &properties, const Ref <SubTexture2D> &subTexture, float rotation) {
+    }
+
+    void Renderer2D::drawQuads(const QuadInstance* begin, size_t count, const Ref<SubTexture2D>* textures, size_t textureCount) {
+
+        QuadTexture* palette = buildQuadTexturePalette(textures, textureCount);
+        submitQuads(QuadInstanceSource{begin}, count, palette, textureCount, false);
+
+    }
+
+    void Renderer2D::drawQuads(const QuadArrays& quads, size_t count) {
+
+        drawQuads(quads, count, s_Data.whiteTexture);
+
+    }
+
+    void Renderer2D::drawQuads(const QuadArrays& quads, size_t count, const Ref<Texture2D>& texture) {
+
+        QuadTexture palette = {texture->getHandle(), s_TextureCoords};
+        submitQuads(QuadArraysSource{quads}, count, &palette, 1, true);
+
+    }
+
+    void Renderer2D::drawQuads(const QuadArrays& quads, size_t count, const Ref<SubTexture2D>* textures, size_t textureCount) {
+
+        QuadTexture* palette = buildQuadTexturePalette(textures, textureCount);
+        submitQuads(QuadArraysSource{quads}, count, palette, textureCount, false);
+
+    }
+
+    void Renderer2D::submit(RecordingContext& context, uint32_t mergeOrder) {
+
+        s_Data.submittedContexts.push_back({&context, mergeOrder});
+
+    }
+
+    /**
+     * \brief Gets the shader static batches are drawn with, creating it the first time if textureShader does not fit.
+     */
+    static const Ref<Shader>& getStaticBatchShader(){
+
+        if(!s_Data.textureTable && s_Data.quadMode == Renderer2D::QuadMode::VERTICES)
+            return s_Data.textureShader;
+
+        if(!s_Data.staticBatchShader){
+            ShaderDefines defines = getQuadShaderDefines(true);
+            defines["GEOGL_COMPACT_VERTICES"] = "0";
+            s_Data.staticBatchShader = createTextureShader("Texture", nullptr, defines);
+        }
+
+        return s_Data.staticBatchShader;
+
+    }
+
+    void Renderer2D::drawStaticBatch(StaticBatch& batch) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* guard against buffer overflow */
-        if(s_Data.quadIndexCount >= s_Data.maxIndices || s_Data.textureSlotIndex >= GEOGL::Renderer2DData::maxTextureSlots){
-            flush();
+        if(!batch.isBuilt()){
+            if(batch.getQuads().empty())
+                return;
+            batch.build();
         }
 
-        auto texture = subTexture->getTexture();
+        if(batch.m_BoundsMax.x < s_Data.viewBoundsMin.x || batch.m_BoundsMin.x > s_Data.viewBoundsMax.x ||
+           batch.m_BoundsMax.y < s_Data.viewBoundsMin.y || batch.m_BoundsMin.y > s_Data.viewBoundsMax.y){
+            s_Data.stats.culledQuadCount += batch.m_QuadCount;
+            return;
+        }
+
+        /* Keep the order things were drawn in */
+        emitDeferredQuads();
+        Renderer2D::flush();
 
-        glm::mat4 transform = glm::translate(s_IdentMatrix, properties.position);
-        transform = (rotation!=0) ? glm::rotate(transform, (rotation), {0,0,1}) : transform;
-        transform = glm::scale(transform, {properties.size.x, properties.size.y, 1.0f});
+        const Ref<Shader>& shader = getStaticBatchShader();
+        shader->bind();
 
-        glm::vec3 position = properties.position;
+        batch.m_VertexArray->bind();
+        for(const auto& segment : batch.m_Segments){
+            for(uint32_t i = 0; i < segment.textures.size(); ++i){
+                segment.textures[i]->bind(i);
+            }
 
-        float textureIndex = -1;
+            RenderCommand::drawIndexed(batch.m_VertexArray, segment.indexCount, segment.baseVertex);
+            s_Data.stats.drawCalls++;
+        }
+        s_Data.stats.quadCount += batch.m_QuadCount;
+
+    }
 
-        for(uint32_t i=0; i<s_Data.textureSlotIndex;++i){
-            if(*s_Data.textureSlots[i] == *texture){
-                textureIndex = (float)i;
-                break;
+    /**
+     * \brief Creates the shader and unit quad TileMaps are drawn with.
+     */
+    static void createTileMapResources(){
+        GEOGL_PROFILE_FUNCTION();
+
+        s_Data.tileMapShader = Shader::createFromSource(loadBuiltinShaderSource("TileMap", {}), "TileMap");
+        s_Data.tileMapShader->bind();
+        s_Data.tileMapShader->setInt(s_TilesUniform, 0);
+        s_Data.tileMapShader->setInt(s_TextureAtlasUniform, 1);
+
+        float vertices[] = {0,0, 1,0, 1,1, 0,1};
+        auto vertexBuffer = VertexBuffer::create(vertices, sizeof(vertices));
+        vertexBuffer->setLayout({
+                                        {ShaderDataType::FLOAT2, "a_Position"}
+                                });
+
+        s_Data.tileMapVertexArray = VertexArray::create();
+        s_Data.tileMapVertexArray->addVertexBuffer(vertexBuffer);
+        s_Data.tileMapVertexArray->setIndexBuffer(createQuadIndexBuffer(1));
+
+    }
+
+    void Renderer2D::drawTileMap(TileMap& tileMap) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        /* Keep the order things were drawn in */
+        emitDeferredQuads();
+        Renderer2D::flush();
+
+        if(!s_Data.tileMapShader)
+            createTileMapResources();
+
+        const Ref<Texture2D>& textureAtlas = tileMap.getTextureAtlas();
+        glm::vec2 atlasSize = {(float)textureAtlas->getWidth(), (float)textureAtlas->getHeight()};
+
+        s_Data.tileMapShader->bind();
+        s_Data.tileMapShader->setInt(s_AtlasColumnsUniform, (int)tileMap.m_AtlasColumns);
+        s_Data.tileMapShader->setFloat2(s_CellSizeUniform, tileMap.getCellSize() / atlasSize);
+
+        textureAtlas->bind(1);
+        s_Data.tileMapVertexArray->bind();
+
+        const glm::vec3& mapPosition = tileMap.getPosition();
+        const glm::vec2& tileSize = tileMap.getTileSize();
+        for(auto& chunk : tileMap.m_Chunks){
+            if(!chunk.tileCount)
+                continue;
+
+            glm::vec2 chunkSize = glm::vec2(chunk.size) * tileSize;
+            glm::vec3 chunkPosition = mapPosition + glm::vec3(glm::vec2(chunk.origin) * tileSize, 0.0f);
+
+            /* Chunks outside of the view are neither uploaded nor drawn */
+            Quad2DTransform chunkBounds(chunkPosition + glm::vec3(chunkSize * 0.5f, 0.0f), chunkSize);
+            if(!chunkBounds.overlaps(s_Data.viewBoundsMin, s_Data.viewBoundsMax)){
+                ++s_Data.stats.culledQuadCount;
+                continue;
             }
+
+            tileMap.uploadChunk(chunk);
+            chunk.tileTexture->bind(0);
+
+            s_Data.tileMapShader->setFloat3(s_ChunkPositionUniform, chunkPosition);
+            s_Data.tileMapShader->setFloat2(s_ChunkSizeUniform, chunkSize);
+            s_Data.tileMapShader->setFloat2(s_ChunkTilesUniform, glm::vec2(chunk.size));
+
+            RenderCommand::drawIndexed(s_Data.tileMapVertexArray, 6);
+            s_Data.stats.drawCalls++;
+            s_Data.stats.quadCount++;
         }
 
-        if(textureIndex==-1){
-            textureIndex = (float)s_Data.textureSlotIndex;
-            s_Data.textureSlots[s_Data.textureSlotIndex] = texture;
-            ++s_Data.textureSlotIndex;
+    }
+
+    /*
+     * Static Batch
+     */
+
+    void Renderer2D::StaticBatch::build() {
+        GEOGL_PROFILE_FUNCTION();
+
+        const auto& quads = getQuads();
+        m_QuadCount = (uint32_t)quads.size();
+        m_Segments.clear();
+
+        std::vector<QuadVertex> vertices(quads.size() * 4);
+
+        /* The slot of each texture in the current segment, keyed by generation and renderer ID */
+        std::unordered_map<uint64_t, uint32_t> segmentSlots;
+        m_Segments.push_back({0, 0, {}});
+
+        m_BoundsMin = glm::vec2(std::numeric_limits<float>::max());
+        m_BoundsMax = glm::vec2(std::numeric_limits<float>::lowest());
+
+        QuadVertex* vertex = vertices.data();
+        for(const auto& quad : quads){
+
+            glm::vec2 halfExtents = quad.transform.getHalfExtents();
+            m_BoundsMin = glm::min(m_BoundsMin, glm::vec2(quad.transform.position) - halfExtents);
+            m_BoundsMax = glm::max(m_BoundsMax, glm::vec2(quad.transform.position) + halfExtents);
+
+            Ref<Texture2D> texture = quad.texture.isValid() ? Texture2D::resolve(quad.texture) : nullptr;
+            GEOGL_CORE_ASSERT(texture || !quad.texture.isValid(), "Tried to build a static batch with texture {}, which has already been destroyed.", quad.texture.rendererID);
+            if(!texture)
+                texture = s_Data.whiteTexture;
+
+            TextureHandle handle = texture->getHandle();
+            uint64_t key = ((uint64_t)handle.generation << 32) | handle.rendererID;
+
+            auto slot = segmentSlots.find(key);
+            if(slot == segmentSlots.end()){
+                /* Out of slots, so start a new segment after the vertices written so far */
+                if(m_Segments.back().textures.size() >= s_Data.maxTextureSlots){
+                    m_Segments.push_back({(uint32_t)(vertex - vertices.data()), 0, {}});
+                    segmentSlots.clear();
+                }
+
+                Segment& segment = m_Segments.back();
+                slot = segmentSlots.emplace(key, (uint32_t)segment.textures.size()).first;
+                segment.textures.push_back(std::move(texture));
+            }
+
+            const glm::vec4& rect = quad.textureRect;
+            const glm::vec2 textureCoords[4] = {{rect.x, rect.y}, {rect.z, rect.y}, {rect.z, rect.w}, {rect.x, rect.w}};
+
+            QuadVertexKernel::generateCorners(&quad.transform, 1, &vertex->position, sizeof(QuadVertex));
+            writeQuadAttributes(vertex, quad.colorTint, textureCoords, quad.tilingFactor, (float)slot->second);
+            vertex += 4;
+
+            m_Segments.back().indexCount += 6;
         }
 
-        //glm::vec2 textureCoords[] = {{0,0}, {1,0}, {1,1}, {0,1}};
-        auto textureCoords = subTexture->getTextureCoords();
+        /* Every segment starts its indices at its base vertex, so one index buffer fits the largest segment */
+        uint32_t maxSegmentQuads = 0;
+        for(const auto& segment : m_Segments)
+            maxSegmentQuads = std::max(maxSegmentQuads, segment.indexCount / 6);
 
-        for(int i=0; i<4; ++i){
-            s_Data.quadVertexBufferPtr->position = transform * s_Data.quadVertexPositions[i];
-            s_Data.quadVertexBufferPtr->color = properties.colorTint;
-            s_Data.quadVertexBufferPtr->textureCoord = textureCoords[i];
-            s_Data.quadVertexBufferPtr->tilingFactor = properties.tilingFactor;
-            s_Data.quadVertexBufferPtr->textureIndex = textureIndex;
-            s_Data.quadVertexBufferPtr++;
+        if(!s_Data.staticBatchIndexBuffer || s_Data.staticBatchIndexBuffer->getCount() < maxSegmentQuads * 6){
+            uint32_t quadCount = 1024;
+            while(quadCount < maxSegmentQuads)
+                quadCount *= 2;
+            s_Data.staticBatchIndexBuffer = createQuadIndexBuffer(quadCount);
         }
 
+        auto vertexBuffer = VertexBuffer::create((float*)vertices.data(), (uint32_t)(vertices.size() * sizeof(QuadVertex)));
+        vertexBuffer->setLayout(s_QuadVertexLayout);
 
-        s_Data.quadIndexCount += 6;
+        m_VertexArray = VertexArray::create();
+        m_VertexArray->addVertexBuffer(vertexBuffer);
+        m_VertexArray->setIndexBuffer(s_Data.staticBatchIndexBuffer);
 
-        ++s_Data.stats.quadCount;
+    }
+
+    /*
+     * Recording Context
+     */
+
+    void Renderer2D::RecordingContext::drawQuad(const QuadProperties& properties) {
+
+        drawQuad(properties, TextureHandle());
+
+    }
+
+    void Renderer2D::RecordingContext::drawQuad(const QuadProperties& properties, const Ref<Texture2D>& texture) {
+
+        drawQuad(properties, texture->getHandle());
+
+    }
+
+    void Renderer2D::RecordingContext::drawQuad(const QuadProperties& properties, const Ref<SubTexture2D>& subTexture) {
+
+        const glm::vec2* textureCoords = subTexture->getTextureCoords();
+        m_Quads.push_back({{properties.position, properties.size}, properties.colorTint, {textureCoords[0], textureCoords[2]}, properties.tilingFactor, subTexture->getTexture()->getHandle()});
+        m_Finished = false;
+
+    }
+
+    void Renderer2D::RecordingContext::drawQuad(const QuadProperties& properties, TextureHandle texture) {
+
+        m_Quads.push_back({{properties.position, properties.size}, properties.colorTint, {0,0,1,1}, properties.tilingFactor, texture});
+        m_Finished = false;
+
+    }
+
+    void Renderer2D::RecordingContext::drawRotatedQuad(const QuadProperties& properties, float rotation) {
+
+        drawRotatedQuad(properties, TextureHandle(), rotation);
+
+    }
+
+    void Renderer2D::RecordingContext::drawRotatedQuad(const QuadProperties& properties, const Ref<Texture2D>& texture, float rotation) {
+
+        drawRotatedQuad(properties, texture->getHandle(), rotation);
+
+    }
+
+    void Renderer2D::RecordingContext::drawRotatedQuad(const QuadProperties& properties, const Ref<SubTexture2D>& subTexture, float rotation) {
+
+        const glm::vec2* textureCoords = subTexture->getTextureCoords();
+        m_Quads.push_back({Quad2DTransform::fromRotation(properties.position, properties.size, rotation), properties.colorTint, {textureCoords[0], textureCoords[2]}, properties.tilingFactor, subTexture->getTexture()->getHandle()});
+        m_Finished = false;
+
+    }
+
+    void Renderer2D::RecordingContext::drawRotatedQuad(const QuadProperties& properties, TextureHandle texture, float rotation) {
+
+        m_Quads.push_back({Quad2DTransform::fromRotation(properties.position, properties.size, rotation), properties.colorTint, {0,0,1,1}, properties.tilingFactor, texture});
+        m_Finished = false;
+
+    }
+
+    void Renderer2D::RecordingContext::finish() {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        FinishedVertexFormat vertexFormat = getFinishedVertexFormat();
+        m_VertexFormatKey = (uint32_t)vertexFormat;
+        m_Vertices.resize(m_Quads.size() * getFinishedQuadSize(vertexFormat));
+        m_Segments.clear();
+        m_SegmentTextures.clear();
+
+        TextureHandle whiteTexture = s_Data.whiteTexture->getHandle();
+        uint32_t maxSegmentTextures = s_Data.maxTextureSlots;
+
+        constexpr size_t chunkSize = 128;
+        Quad2DTransform transforms[chunkSize];
+        float textureIndices[chunkSize];
+
+        TextureHandle lastTexture;
+        float lastTextureIndex = -1;
+
+        size_t quad = 0;
+        while(quad < m_Quads.size()){
+
+            /* Number the textures of each segment from 0, starting a new segment once it is full of quads or textures */
+            size_t chunk = std::min(chunkSize, m_Quads.size() - quad);
+            for(size_t i = 0; i < chunk; ++i){
+                const RecordedQuad& recordedQuad = m_Quads[quad + i];
+                TextureHandle texture = recordedQuad.texture.isValid() ? recordedQuad.texture : whiteTexture;
+
+                if(m_Segments.empty() || m_Segments.back().quadCount == s_MaxSegmentQuads){
+                    m_Segments.push_back({(uint32_t)(quad + i), 0, (uint32_t)m_SegmentTextures.size(), 0,
+                                          glm::vec2(std::numeric_limits<float>::max()), glm::vec2(std::numeric_limits<float>::lowest())});
+                    lastTextureIndex = -1;
+                }
+                Segment* segment = &m_Segments.back();
+
+                if(lastTextureIndex < 0 || texture != lastTexture){
+                    auto segmentTexturesBegin = m_SegmentTextures.begin() + segment->firstTexture;
+                    auto found = std::find(segmentTexturesBegin, m_SegmentTextures.end(), texture);
+
+                    if(found == m_SegmentTextures.end() && segment->textureCount == maxSegmentTextures){
+                        m_Segments.push_back({(uint32_t)(quad + i), 0, (uint32_t)m_SegmentTextures.size(), 0,
+                                              glm::vec2(std::numeric_limits<float>::max()), glm::vec2(std::numeric_limits<float>::lowest())});
+                        segment = &m_Segments.back();
+                    }
+
+                    if(found == m_SegmentTextures.end()){
+                        m_SegmentTextures.push_back(texture);
+                        lastTextureIndex = (float)segment->textureCount++;
+                    }else{
+                        lastTextureIndex = (float)(found - segmentTexturesBegin);
+                    }
+                    lastTexture = texture;
+                }
+
+                glm::vec2 halfExtents = recordedQuad.transform.getHalfExtents();
+                segment->boundsMin = glm::min(segment->boundsMin, glm::vec2(recordedQuad.transform.position) - halfExtents);
+                segment->boundsMax = glm::max(segment->boundsMax, glm::vec2(recordedQuad.transform.position) + halfExtents);
+                ++segment->quadCount;
+
+                transforms[i] = recordedQuad.transform;
+                textureIndices[i] = lastTextureIndex;
+            }
+
+            uint8_t* chunkVertices = m_Vertices.data() + quad * getFinishedQuadSize(vertexFormat);
+            if(vertexFormat == FinishedVertexFormat::INSTANCED){
+                auto* instance = reinterpret_cast<QuadInstanceVertex*>(chunkVertices);
+                for(size_t i = 0; i < chunk; ++i){
+                    const RecordedQuad& recordedQuad = m_Quads[quad + i];
+                    *instance++ = {transforms[i], recordedQuad.colorTint, recordedQuad.textureRect, recordedQuad.tilingFactor, textureIndices[i]};
+                }
+            }else{
+                /* Both vertex formats are written the same way, only the attribute packing differs */
+                auto writeVertices = [&](auto* vertex){
+                    QuadVertexKernel::generateCorners(transforms, chunk, &vertex->position, sizeof(*vertex));
+
+                    for(size_t i = 0; i < chunk; ++i){
+                        const RecordedQuad& recordedQuad = m_Quads[quad + i];
+                        const glm::vec4& rect = recordedQuad.textureRect;
+                        const glm::vec2 textureCoords[4] = {{rect.x, rect.y}, {rect.z, rect.y}, {rect.z, rect.w}, {rect.x, rect.w}};
+
+                        writeQuadAttributes(vertex, recordedQuad.colorTint, textureCoords, recordedQuad.tilingFactor, textureIndices[i]);
+                        vertex += 4;
+                    }
+                };
+
+                if(vertexFormat == FinishedVertexFormat::COMPACT)
+                    writeVertices(reinterpret_cast<CompactQuadVertex*>(chunkVertices));
+                else
+                    writeVertices(reinterpret_cast<QuadVertex*>(chunkVertices));
+            }
+
+            quad += chunk;
+        }
+
+        m_Finished = true;
 
     }
 
@@ -441,6 +1689,62 @@ namespace GEOGL{
 
     }
 
+    void Renderer2D::setSubmissionMode(SubmissionMode submissionMode) {
+
+        /* Anything already recorded keeps the order it was recorded in */
+        emitDeferredQuads();
+        s_Data.submissionMode = submissionMode;
+
+    }
+
+    Renderer2D::SubmissionMode Renderer2D::getSubmissionMode() {
+
+        return s_Data.submissionMode;
+
+    }
+
+    void Renderer2D::setViewCulling(bool enabled) {
+
+        s_Data.viewCulling = enabled;
+
+    }
+
+    bool Renderer2D::getViewCulling() {
+
+        return s_Data.viewCulling;
+
+    }
+
+    Renderer2D::QuadMode Renderer2D::getQuadMode() {
+
+        return s_Data.quadMode;
+
+    }
+
+    uint32_t Renderer2D::getMaxQuadsPerBatch() {
+
+        return s_Data.maxQuads;
+
+    }
+
+    uint32_t Renderer2D::getMaxTextureSlots() {
+
+        return s_Data.maxTextureSlots;
+
+    }
+
+    Renderer2D::VertexFormat Renderer2D::getVertexFormat() {
+
+        return s_Data.vertexFormat;
+
+    }
+
+    Renderer2D::TextureBinding Renderer2D::getTextureBinding() {
+
+        return s_Data.textureBinding;
+
+    }
+
 
 }
 
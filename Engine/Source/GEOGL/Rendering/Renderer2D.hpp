@@ -30,6 +30,8 @@
 #include "Shader.hpp"
 #include "Texture.hpp"
 #include "SubTexture2D.hpp"
+#include "QuadVertexKernel.hpp"
+#include "TileMap.hpp"
 
 namespace GEOGL {
 
@@ -53,8 +55,264 @@ namespace GEOGL {
 	        float tilingFactor      = 1;
 	    };
 
+	    /**
+	     * Defines a single quad submitted in bulk through Renderer2D::drawQuads.
+	     *
+	     * textureIndex selects an entry of the texture palette passed to drawQuads, and is ignored when
+	     * drawQuads is given a single texture.
+	     */
+	    struct QuadInstance{
+
+	        inline QuadInstance(    const glm::vec3& quadPosition = {0,0,0},
+	                                const glm::vec2& quadSize = {1,1},
+	                                const glm::vec4& quadColorTint = {1,1,1,1},
+	                                float quadRotation = 0,
+	                                uint32_t quadTextureIndex = 0,
+	                                float quadTilingFactor = 1)
+	                               : position(quadPosition), size(quadSize), colorTint(quadColorTint), rotation(quadRotation), textureIndex(quadTextureIndex), tilingFactor(quadTilingFactor){};
+
+	        glm::vec3 position      = {0,0,0};
+	        glm::vec2 size          = {1,1};
+	        glm::vec4 colorTint     = {1,1,1,1};
+	        float rotation          = 0;
+	        uint32_t textureIndex   = 0;
+	        float tilingFactor      = 1;
+	    };
+
+	    /**
+	     * Defines quads to be submitted in bulk through Renderer2D::drawQuads as a structure of arrays.
+	     *
+	     * positions and sizes are required. Any of the other arrays may be left as nullptr, in which case every quad
+	     * uses the default from QuadInstance.
+	     */
+	    struct QuadArrays{
+	        const glm::vec3* positions      = nullptr;
+	        const glm::vec2* sizes          = nullptr;
+	        const glm::vec4* colorTints     = nullptr;
+	        const float* rotations          = nullptr;
+	        const uint32_t* textureIndices  = nullptr;
+	        const float* tilingFactors      = nullptr;
+	    };
+
+	    /**
+	     * Selects how the Renderer2D submits quads to the GPU.
+	     */
+	    enum class GEOGL_API QuadMode{
+	        /**
+	         * Every quad is expanded into four vertices on the CPU.
+	         */
+	        VERTICES = 0,
+
+	        /**
+	         * Every quad is a single per instance record, expanded into its four corners by the vertex shader. This
+	         * uploads roughly a third of the data of VERTICES.
+	         */
+	        INSTANCED
+	    };
+
+	    /**
+	     * Selects when the Renderer2D writes quads into batches.
+	     */
+	    enum class GEOGL_API SubmissionMode{
+	        /**
+	         * Quads are written into the batch as they are drawn, in call order.
+	         */
+	        IMMEDIATE = 0,
+
+	        /**
+	         * Quads are recorded with a 64 bit sort key, and written into batches in sorted order by endScene. Opaque
+	         * quads are drawn front to back, then translucent quads back to front, grouped by texture at each depth.
+	         * Every texture drawn must stay alive until endScene.
+	         */
+	        DEFERRED
+	    };
+
+	    /**
+	     * Selects the vertex layout of QuadMode::VERTICES.
+	     */
+	    enum class GEOGL_API VertexFormat{
+	        /**
+	         * 44 byte vertices of full precision floats.
+	         */
+	        FULL = 0,
+
+	        /**
+	         * 24 byte vertices, with an RGBA8 color, unorm16 texture coordinates, a half float tiling factor, and a
+	         * 16 bit texture index. Cuts the vertex bandwidth by 45%, at the cost of color and texture coordinate
+	         * precision.
+	         */
+	        COMPACT
+	    };
+
+	    /**
+	     * Selects how the textures of a batch are made available to the shader.
+	     */
+	    enum class GEOGL_API TextureBinding{
+	        /**
+	         * BINDLESS where supported, otherwise SLOTS. TEXTURE_ARRAYS copies every texture, so it is only used when
+	         * asked for.
+	         */
+	        AUTOMATIC = 0,
+
+	        /**
+	         * Every texture is bound to a texture unit, so a batch is flushed once it uses more textures than the GPU
+	         * has units.
+	         */
+	        SLOTS,
+
+	        /**
+	         * Textures are copied into the layers of texture arrays of the same size and format, so a batch is only
+	         * flushed once it uses more sizes than the GPU has units. Falls back to SLOTS without OpenGL 4.3.
+	         */
+	        TEXTURE_ARRAYS,
+
+	        /**
+	         * Textures are referenced through bindless handles, so a batch is only flushed after thousands of textures.
+	         * Falls back to TEXTURE_ARRAYS without ARB_bindless_texture.
+	         */
+	        BINDLESS
+	    };
+
+	    /**
+	     * Sizes the batches of the Renderer2D. Pass to init, or set ApplicationProperties::renderer2DBatchProperties,
+	     * which the "Renderer2D" section of settings.json overrides.
+	     */
+	    struct BatchProperties{
+	        QuadMode quadMode = QuadMode::VERTICES;
+	        VertexFormat vertexFormat = VertexFormat::FULL;
+
+	        /**
+	         * The quads a batch holds before flushing, or 0 for the engine default.
+	         */
+	        uint32_t maxQuads = 0;
+
+	        /**
+	         * The textures a batch binds before flushing, or 0 for every texture unit the GPU has. Clamped to the
+	         * texture units of the GPU.
+	         */
+	        uint32_t maxTextureSlots = 0;
+
+	        /**
+	         * Whether a scene that did not fit into one batch grows the batch for the next scene. Batches only grow. Off by default.
+	         */
+	        bool adaptiveBatchSize = false;
+
+	        TextureBinding textureBinding = TextureBinding::AUTOMATIC;
+	    };
+
+	    /**
+	     * A quad recorded to be submitted later, by a RecordingContext or by SubmissionMode::DEFERRED.
+	     */
+	    struct RecordedQuad{
+	        Quad2DTransform transform;
+	        glm::vec4 colorTint;
+	        glm::vec4 textureRect;
+	        float tilingFactor;
+	        TextureHandle texture;
+	    };
+
+	    /**
+	     * Records quads without touching any renderer state, so that several threads can each record into their own
+	     * context at once. Hand the context to Renderer2D::submit on the rendering thread to draw it.
+	     *
+	     * Calling finish() on the worker thread after recording generates the vertices there too, into a stream of the
+	     * context's own, so merging the context at endScene only copies them into the batch and renumbers the textures.
+	     *
+	     * A default constructed TextureHandle draws untextured. The recorded quads are kept until clear() is called, so
+	     * a context that does not change can be submitted every frame, and is only finished once.
+	     */
+	    class GEOGL_API RecordingContext{
+	    public:
+	        void drawQuad(const QuadProperties& properties);
+	        void drawQuad(const QuadProperties& properties, const Ref<Texture2D>& texture);
+	        void drawQuad(const QuadProperties& properties, const Ref<SubTexture2D>& texture);
+	        void drawQuad(const QuadProperties& properties, TextureHandle texture);
+
+	        void drawRotatedQuad(const QuadProperties& properties, float rotation = 0);
+	        void drawRotatedQuad(const QuadProperties& properties, const Ref<Texture2D>& texture, float rotation = 0);
+	        void drawRotatedQuad(const QuadProperties& properties, const Ref<SubTexture2D>& texture, float rotation = 0);
+	        void drawRotatedQuad(const QuadProperties& properties, TextureHandle texture, float rotation = 0);
+
+	        /**
+	         * Generates the vertices of the recorded quads on the calling thread, in the vertex format of the
+	         * Renderer2D, split into segments that each use no more textures than a batch can hold.
+	         *
+	         * Only reads the configuration of the Renderer2D, so any number of contexts can be finished at once. A
+	         * context that is submitted unfinished, or recorded into since it was finished, is finished at endScene.
+	         */
+	        void finish();
+	        [[nodiscard]] inline bool isFinished() const { return m_Finished; };
+
+	        inline void clear() { m_Quads.clear(); m_Vertices.clear(); m_Segments.clear(); m_SegmentTextures.clear(); m_Finished = false; };
+	        inline void reserve(size_t quadCount) { m_Quads.reserve(quadCount); };
+
+	        [[nodiscard]] inline const std::vector<RecordedQuad>& getQuads() const { return m_Quads; };
+
+	    private:
+	        /**
+	         * A run of finished quads whose vertices number their textures from 0, in the order of the segment's
+	         * entries in m_SegmentTextures.
+	         */
+	        struct Segment{
+	            uint32_t firstQuad;
+	            uint32_t quadCount;
+	            uint32_t firstTexture;
+	            uint32_t textureCount;
+	            glm::vec2 boundsMin;
+	            glm::vec2 boundsMax;
+	        };
+
+	        std::vector<RecordedQuad> m_Quads;
+
+	        /* The vertex stream written by finish, in the vertex format it was finished with */
+	        std::vector<uint8_t> m_Vertices;
+	        std::vector<Segment> m_Segments;
+	        std::vector<TextureHandle> m_SegmentTextures;
+	        uint32_t m_VertexFormatKey = 0;
+	        bool m_Finished = false;
+
+	        friend class Renderer2D;
+	    };
+
+	    /**
+	     * A RecordingContext for geometry that does not change between frames. Renderer2D::drawStaticBatch uploads its
+	     * quads once into an immutable vertex buffer of its own, then draws it every frame, under any camera, with one
+	     * draw call per set of textures that fits in the texture slots.
+	     *
+	     * Quads recorded after the batch is built are not drawn until invalidate() is called, which drops the GPU data so
+	     * that the next draw rebuilds it from the recorded quads.
+	     */
+	    class GEOGL_API StaticBatch : public RecordingContext{
+	    public:
+	        inline void invalidate() { m_VertexArray = nullptr; m_Segments.clear(); m_QuadCount = 0; };
+	        [[nodiscard]] inline bool isBuilt() const { return m_VertexArray != nullptr; };
+
+	    private:
+	        /**
+	         * A run of quads drawn with one set of textures, bound to the slots in order.
+	         */
+	        struct Segment{
+	            uint32_t baseVertex;
+	            uint32_t indexCount;
+	            std::vector<Ref<Texture2D>> textures;
+	        };
+
+	        void build();
+
+	        Ref<VertexArray> m_VertexArray;
+	        std::vector<Segment> m_Segments;
+	        uint32_t m_QuadCount = 0;
+
+	        /* The world space box around every quad, so batches outside of the view are not drawn at all */
+	        glm::vec2 m_BoundsMin{0.0f};
+	        glm::vec2 m_BoundsMax{0.0f};
+
+	        friend class Renderer2D;
+	    };
+
 	public:
-	    static void init(const std::string& applicationResourceDirectory);
+	    static void init(QuadMode quadMode = QuadMode::VERTICES);
+	    static void init(const BatchProperties& properties);
 	    static void shutdown();
 
 		static void beginScene(const OrthographicCamera& camera);
@@ -67,20 +325,71 @@ namespace GEOGL {
          */
         static void renderWireframe(bool status);
 
+        /**
+         * \brief Queues a RecordingContext to be drawn at endScene.
+         *
+         * Contexts are merged in ascending mergeOrder, and contexts with the same mergeOrder in the order they were
+         * submitted, so the output does not depend on which worker thread finished first. They are drawn after the
+         * quads drawn directly during the scene, and must stay alive until endScene.
+         *
+         * Finished contexts are copied into the batch as they are. In SubmissionMode::DEFERRED, their quads are sorted
+         * with the rest of the scene instead, so their vertices are generated again on the main thread.
+         *
+         * @param context The context to draw
+         * @param mergeOrder The position of the context in the merge
+         */
+        static void submit(RecordingContext& context, uint32_t mergeOrder = 0);
+
+        /**
+         * \brief Draws a StaticBatch, building it first if it has not been built since it was last invalidated.
+         *
+         * Anything drawn earlier in the scene is flushed first, so the static batch is drawn on top of it. In
+         * SubmissionMode::DEFERRED, this splits the sort in two.
+         *
+         * @param batch The batch to draw
+         */
+        static void drawStaticBatch(StaticBatch& batch);
+
+        /**
+         * \brief Draws a TileMap, one quad per visible chunk, uploading the chunks whose tiles changed since the last
+         * draw. Like drawStaticBatch, anything drawn earlier in the scene is flushed first.
+         *
+         * @param tileMap The map to draw
+         */
+        static void drawTileMap(TileMap& tileMap);
+
         // primitives rendering
         static void drawQuad(const QuadProperties& properties);
         static void drawQuad(const QuadProperties& properties, const Ref<Texture2D>& texture);;
         static void drawQuad(const QuadProperties& properties, const Ref<SubTexture2D>& texture);
+        static void drawQuad(const QuadProperties& properties, TextureHandle texture);
 
 
         static void drawRotatedQuad(const QuadProperties& properties, float rotation = 0);
         static void drawRotatedQuad(const QuadProperties& properties, const Ref<Texture2D>& texture, float rotation = 0);
         static void drawRotatedQuad(const QuadProperties& properties, const Ref<SubTexture2D>& texture, float rotation = 0);
+        static void drawRotatedQuad(const QuadProperties& properties, TextureHandle texture, float rotation = 0);
+
+        /**
+         * \brief Draws count quads in one call, filling the batch in tight loops and only splitting it where the
+         * vertex buffer or texture slots run out.
+         *
+         * The overloads without a texture draw untextured quads, the overloads taking a single texture draw every
+         * quad with it, and the overloads taking a palette draw each quad with textures[textureIndex].
+         */
+        static void drawQuads(const QuadInstance* begin, size_t count);
+        static void drawQuads(const QuadInstance* begin, size_t count, const Ref<Texture2D>& texture);
+        static void drawQuads(const QuadInstance* begin, size_t count, const Ref<SubTexture2D>* textures, size_t textureCount);
+
+        static void drawQuads(const QuadArrays& quads, size_t count);
+        static void drawQuads(const QuadArrays& quads, size_t count, const Ref<Texture2D>& texture);
+        static void drawQuads(const QuadArrays& quads, size_t count, const Ref<SubTexture2D>* textures, size_t textureCount);
 
 	public:
         struct Statistics{
             uint32_t drawCalls;
             uint32_t quadCount;
+            uint32_t culledQuadCount;
 
             inline uint32_t getTotalVertexCount() {return quadCount*4; };
             inline uint32_t getTotalIndexCount() { return quadCount*6; };
@@ -90,6 +399,50 @@ namespace GEOGL {
         static void resetStats();
         static Statistics getStatistics();
 
+        /**
+         * \brief Gets the QuadMode the Renderer2D was initialized with.
+         */
+        static QuadMode getQuadMode();
+
+        /**
+         * \brief Gets the quads a batch currently holds before flushing.
+         */
+        static uint32_t getMaxQuadsPerBatch();
+
+        /**
+         * \brief Gets the textures a batch binds before flushing.
+         */
+        static uint32_t getMaxTextureSlots();
+
+        /**
+         * \brief Gets the VertexFormat in use. Always FULL in QuadMode::INSTANCED.
+         */
+        static VertexFormat getVertexFormat();
+
+        /**
+         * \brief Gets the TextureBinding in use, after falling back from any the GPU does not support.
+         */
+        static TextureBinding getTextureBinding();
+
+        /**
+         * \brief Sets when quads are written into batches. Quads already recorded in DEFERRED mode are written first.
+         */
+        static void setSubmissionMode(SubmissionMode submissionMode);
+        static SubmissionMode getSubmissionMode();
+
+        /**
+         * \brief Sets whether quads outside of the world bounds of the camera are skipped instead of drawn. Culling is
+         * conservative, so some quads just outside of the view are still drawn. Takes effect at the next beginScene.
+         */
+        static void setViewCulling(bool enabled);
+        static bool getViewCulling();
+
+    private:
+        /**
+         * \brief Copies the finished vertices of every RecordingContext handed to submit into batches, in ascending
+         * merge order.
+         */
+        static void mergeRecordingContexts();
 
     };
 
@@ -35,6 +35,10 @@
 #include "../../Platform/Vulkan/Rendering/VulkanRendererAPI.hpp"
 #endif
 
+#if GEOGL_BUILD_WITH_NULL == 1
+#include "../../Platform/Null/Rendering/NullRendererAPI.hpp"
+#endif
+
 namespace GEOGL{
 
 
@@ -52,6 +56,8 @@ namespace GEOGL{
                 return std::string("DirectX 12");
             case RenderingAPIEnum::RENDERING_METAL_DESKTOP:
                 return std::string("Apple Metal");
+            case RenderingAPIEnum::RENDERING_NULL:
+                return std::string("Null");
             default:
                 return std::string("Unknown");
         }
@@ -65,6 +71,8 @@ namespace GEOGL{
 
             case WindowingAPIEnum::WINDOWING_GLFW_DESKTOP:
                 return std::string("GLFW");
+            case WindowingAPIEnum::WINDOWING_NULL:
+                return std::string("Null");
             default:
                 return std::string("Unknown");
 
@@ -80,6 +88,8 @@ namespace GEOGL{
                 return (bool) GEOGL_BUILD_WITH_OPENGL && (bool) GEOGL_BUILD_WITH_GLFW;
             case RenderingAPIEnum::RENDERING_VULKAN_DESKTOP:
                 return (bool) GEOGL_BUILD_WITH_VULKAN && (bool) GEOGL_BUILD_WITH_GLFW;
+            case RenderingAPIEnum::RENDERING_NULL:
+                return (bool) GEOGL_BUILD_WITH_NULL;
             default:
                 return false;
         }
@@ -109,6 +119,8 @@ namespace GEOGL{
                 api = RenderingAPIEnum::RENDERING_DIRECTX11_DESKTOP;
             }else if(isAPISupported(RenderingAPIEnum::RENDERING_DIRECTX12_DESKTOP)){
                 api = RenderingAPIEnum::RENDERING_DIRECTX12_DESKTOP;
+            }else if(isAPISupported(RenderingAPIEnum::RENDERING_NULL)){
+                api = RenderingAPIEnum::RENDERING_NULL;
             }
 
         }
@@ -137,6 +149,15 @@ namespace GEOGL{
 #endif
 
 
+            case RendererAPI::RenderingAPIEnum::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::RendererAPI>();
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported!");
+#endif
+
+
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} Rendering API. Unhandled path.", RendererAPI::getRenderingAPIName(api));
                 return nullptr;
@@ -155,6 +176,9 @@ namespace GEOGL{
         if(WindowingAPIEnum::WINDOWING_GLFW_DESKTOP & m_API)
             return WindowingAPIEnum::WINDOWING_GLFW_DESKTOP;
 
+        if(WindowingAPIEnum::WINDOWING_NULL & m_API)
+            return WindowingAPIEnum::WINDOWING_NULL;
+
         return WINDOWING_INVALID;
 
     }
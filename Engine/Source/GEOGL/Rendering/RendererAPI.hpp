@@ -30,6 +30,51 @@
 
 namespace GEOGL{
 
+    /**
+     * \brief The limits and optional features of the rendering API, queried by RendererAPI::init once a context exists.
+     *
+     * The defaults are the minimums OpenGL 3.3 guarantees, so code sized from the RenderCaps is still correct if it is
+     * read before init.
+     */
+    struct GEOGL_API RenderCaps{
+        /* Texture limits */
+        uint32_t maxTextureImageUnits = 16;
+        uint32_t maxCombinedTextureImageUnits = 48;
+        uint32_t maxTextureSize = 1024;
+        uint32_t maxArrayTextureLayers = 256;
+
+        /* Buffer limits. maxElementsVertices and maxElementsIndices are the batch sizes the driver recommends */
+        uint32_t maxVertexAttributes = 16;
+        uint32_t maxElementsVertices = 0;
+        uint32_t maxElementsIndices = 0;
+        uint32_t maxUniformBlockSize = 16384;
+        uint32_t uniformBufferOffsetAlignment = 256;
+        uint64_t maxShaderStorageBlockSize = 0;
+        uint32_t maxTextureBufferSize = 65536;
+
+        /* Optional features, each either core in the context version or available as an extension */
+        bool bufferStorage = false;
+        bool directStateAccess = false;
+        bool baseInstance = false;
+        bool copyImage = false;
+        bool bindlessTexture = false;
+        bool parallelShaderCompile = false;
+
+        /* Every extension the context reports */
+        std::unordered_set<std::string> extensions;
+
+        [[nodiscard]] inline bool hasExtension(const std::string& extension) const { return extensions.find(extension) != extensions.end(); };
+    };
+
+    /**
+     * \brief Counts the state changes the renderer asked the backend for, and how many of them were skipped because
+     * the state was already set.
+     */
+    struct GEOGL_API StateChangeStatistics{
+        uint64_t issued = 0;
+        uint64_t skipped = 0;
+    };
+
     /**
      * \brief Describes a RendererAPI interface.
      */
@@ -48,6 +93,11 @@ namespace GEOGL{
             RENDERING_DIRECTX11_DESKTOP = BIT(2),
             RENDERING_DIRECTX12_DESKTOP = BIT(3),
             RENDERING_METAL_DESKTOP = BIT(4),
+
+            /**
+             * Draws nothing, and only records what it was asked to do. For benchmarking without a display or GPU.
+             */
+            RENDERING_NULL = BIT(5),
         };
 
         /**
@@ -58,7 +108,8 @@ namespace GEOGL{
             WINDOWING_INVALID = 0,
             WINDOWING_GLFW_DESKTOP = BIT(0) | BIT(1),
             WINDOWING_WIN32_DESKTOP = BIT(2) | BIT(3),
-            WINDOWING_METAL_DESKTOP = BIT(4)
+            WINDOWING_METAL_DESKTOP = BIT(4),
+            WINDOWING_NULL = BIT(5)
 
         };
 
@@ -102,14 +153,44 @@ namespace GEOGL{
         /**
          * Draws an indexed VertexArray.
          * @param vertexArray The VertexArray to draw
+         * @param indexCount The number of indices to draw, or 0 for the whole index buffer
+         * @param baseVertex The value added to every index before fetching the vertex
          */
-        virtual void drawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+        virtual void drawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) = 0;
+
+        /**
+         * Draws instanceCount instances of an indexed VertexArray.
+         * @param vertexArray The VertexArray to draw
+         * @param indexCount The number of indices in each instance, or 0 for the whole index buffer
+         * @param instanceCount The number of instances to draw
+         * @param baseInstance The first instance to fetch per instance data for
+         */
+        virtual void drawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) = 0;
 
         virtual void renderWireframe(bool* status) = 0;
 
         inline RenderingAPIEnum getRenderingAPI() { return m_API; } ;
+
+        /**
+         * \brief Gets the limits and optional features of the rendering API. Only complete after init.
+         */
+        inline const RenderCaps& getCapabilities() const { return m_Capabilities; };
         RendererAPI::WindowingAPIEnum getWindowingAPI();
 
+        /**
+         * \brief Gets how many state changes reached the driver, and how many were filtered out as redundant. Backends
+         * that do not filter state changes report nothing.
+         */
+        virtual StateChangeStatistics getStateChangeStatistics() const { return {}; };
+        virtual void resetStateChangeStatistics() {};
+
+        /**
+         * \brief Gets the dimensions last passed to setViewport, so they can be restored after rendering to a
+         * Framebuffer.
+         */
+        inline const glm::ivec2& getViewport() const { return m_Viewport; };
+        inline const glm::vec4& getClearColor() const { return m_ClearColor; };
+
     protected:
         /**
          * \brief Constructs a RendererAPI with the specified RenderingAPIEnum. The implementation is free to ignore this however.
@@ -117,6 +198,10 @@ namespace GEOGL{
          */
         RendererAPI(RendererAPI::RenderingAPIEnum preferredAPI);
 
+        RenderCaps m_Capabilities;
+        glm::ivec2 m_Viewport{0, 0};
+        glm::vec4 m_ClearColor{0.0f, 0.0f, 0.0f, 1.0f};
+
     private:
         RenderingAPIEnum m_API;
 
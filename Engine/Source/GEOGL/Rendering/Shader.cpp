@@ -35,41 +35,47 @@
 #include "../../Platform/OpenGL/Rendering/OpenGLShader.hpp"
 #endif
 
+#if GEOGL_BUILD_WITH_NULL == 1
+#include "../../Platform/Null/Rendering/NullShader.hpp"
+#endif
+
 namespace GEOGL{
 
     uint32_t Shader::s_BoundShaderID = 0;
+    Shader::CacheStatistics Shader::s_CacheStatistics;
+    std::string Shader::s_CacheDirectory = "ShaderCache";
+    std::unordered_map<std::string, uint32_t> Shader::s_UniformBlockBindings;
+
+    Ref<Shader> Shader::create(const std::string &vertexSrc, const std::string &fragmentSrc, const std::string& name) {
+        GEOGL_PROFILE_FUNCTION();
+
+        const auto renderer = Renderer::getRendererAPI();
 
-    uint32_t shaderDataTypeSize(ShaderDataType type){
-        switch(type){
-            case ShaderDataType::FLOAT:
-                return 4;
-            case ShaderDataType::FLOAT2:
-                return 4*2;
-            case ShaderDataType::FLOAT3:
-                return 4*3;
-            case ShaderDataType::FLOAT4:
-                return 4*4;
-            case ShaderDataType::MAT3:
-                return 4*3*3;
-            case ShaderDataType::MAT4:
-                return 4*4*4;
-            case ShaderDataType::INT:
-                return 4;
-            case ShaderDataType::INT2:
-                return 4*2;
-            case ShaderDataType::INT3:
-                return 4*3;
-            case ShaderDataType::INT4:
-                return 4*4;
-            case ShaderDataType::BOOLEAN:
-                return 1;
+        Ref<Shader> result;
+        switch(renderer->getRenderingAPI()){
+            case RendererAPI::RENDERING_OPENGL_DESKTOP:
+#if GEOGL_BUILD_WITH_OPENGL == 1
+            result = createRef<GEOGL::Platform::OpenGL::Shader>(vertexSrc, fragmentSrc, name);
+            return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::Shader>(vertexSrc, fragmentSrc, name);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
+#endif
             default:
-            GEOGL_CORE_ASSERT(false, "Unknown shader DataType");
-                return 0;
+                GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} shader. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
+                return result;
         }
+
+
     }
 
-    Ref<Shader> Shader::create(const std::string &vertexSrc, const std::string &fragmentSrc, const std::string& name) {
+    Ref<Shader> Shader::create(const std::string& folderPath, const ShaderDefines& defines) {
         GEOGL_PROFILE_FUNCTION();
 
         const auto renderer = Renderer::getRendererAPI();
@@ -78,10 +84,17 @@ namespace GEOGL{
         switch(renderer->getRenderingAPI()){
             case RendererAPI::RENDERING_OPENGL_DESKTOP:
 #if GEOGL_BUILD_WITH_OPENGL == 1
-            result = createRef<GEOGL::Platform::OpenGL::Shader>(vertexSrc, fragmentSrc, name);
-            return result;
+                result = createRef<GEOGL::Platform::OpenGL::Shader>(folderPath, defines);
+                return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::Shader>(folderPath, defines);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} shader. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
@@ -91,7 +104,7 @@ namespace GEOGL{
 
     }
 
-    Ref<Shader> Shader::create(const std::string& folderPath) {
+    Ref<Shader> Shader::createFromSource(const std::string& source, const std::string& name) {
         GEOGL_PROFILE_FUNCTION();
 
         const auto renderer = Renderer::getRendererAPI();
@@ -100,16 +113,118 @@ namespace GEOGL{
         switch(renderer->getRenderingAPI()){
             case RendererAPI::RENDERING_OPENGL_DESKTOP:
 #if GEOGL_BUILD_WITH_OPENGL == 1
-                result = createRef<GEOGL::Platform::OpenGL::Shader>(folderPath);
+                result = createRef<GEOGL::Platform::OpenGL::Shader>(source, name);
                 return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::Shader>(source, name);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} shader. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
                 return result;
         }
 
+    }
+
+    std::vector<Ref<Shader>> Shader::createBatch(const std::vector<std::string>& folderPaths) {
+        GEOGL_PROFILE_FUNCTION();
+
+        const auto renderer = Renderer::getRendererAPI();
+
+        std::vector<Ref<Shader>> result;
+        switch(renderer->getRenderingAPI()){
+            case RendererAPI::RENDERING_OPENGL_DESKTOP:
+#if GEOGL_BUILD_WITH_OPENGL == 1
+                result = GEOGL::Platform::OpenGL::Shader::createBatch(folderPaths);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                for(auto& folderPath : folderPaths)
+                    result.push_back(createRef<GEOGL::Platform::Null::Shader>(folderPath));
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
+#endif
+            default:
+                GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create {} shaders. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
+                return result;
+        }
+
+    }
+
+    std::string Shader::readSource(const std::string& folderPath){
+        GEOGL_PROFILE_FUNCTION();
+
+        std::string filePath = folderPath + "/shader.glsl";
+
+        std::string result;
+        std::ifstream in(filePath, std::ios::in | std::ios::binary);
+        GEOGL_CORE_ASSERT(in, "Could not open shader file {}", filePath);
+        if(!in){
+            GEOGL_CORE_ERROR_NOSTRIP("Could not find shader {}", filePath);
+            return "";
+        }
+
+        in.seekg(0, std::ios::end);
+        result.resize(in.tellg());
+        in.seekg(0, std::ios::beg);
+        in.read(&result[0], (std::streamsize)result.size());
+        in.close();
+
+        return result;
+
+    }
+
+    std::string Shader::loadSource(const std::string& folderPath, const ShaderDefines& defines){
+        GEOGL_PROFILE_FUNCTION();
+
+        return ShaderPreprocessor::process(readSource(folderPath), folderPath, defines);
+
+    }
+
+    void Shader::setCacheDirectory(const std::string& cacheDirectory){
+
+        s_CacheDirectory = cacheDirectory;
+
+    }
+
+    const std::string& Shader::getCacheDirectory(){
+
+        return s_CacheDirectory;
+
+    }
+
+    Shader::CacheStatistics Shader::getCacheStatistics(){
+
+        return s_CacheStatistics;
+
+    }
+
+    void Shader::resetCacheStatistics(){
+
+        s_CacheStatistics = CacheStatistics();
+
+    }
+
+    void Shader::setUniformBlockBinding(const std::string& blockName, uint32_t binding){
+
+        s_UniformBlockBindings[blockName] = binding;
+
+    }
+
+    int32_t Shader::getUniformBlockBinding(const std::string& blockName){
+
+        auto binding = s_UniformBlockBindings.find(blockName);
+        return binding == s_UniformBlockBindings.end() ? -1 : (int32_t) binding->second;
 
     }
 
@@ -147,6 +262,45 @@ namespace GEOGL{
 
     }
 
+    std::vector<std::pair<std::string, Ref<Shader>>> ShaderLibrary::loadBatch(const std::vector<std::string>& folderPaths) {
+        GEOGL_PROFILE_FUNCTION();
+
+        std::vector<std::pair<std::string, Ref<Shader>>> result;
+        result.reserve(folderPaths.size());
+        for(auto& shader : Shader::createBatch(folderPaths)){
+            add(shader);
+            result.emplace_back(shader->getName(), shader);
+        }
+        return result;
+
+    }
+
+    Ref<Shader> ShaderLibrary::getVariant(const std::string& folderPath, const ShaderDefines& defines) {
+        GEOGL_PROFILE_FUNCTION();
+
+        auto key = ShaderPreprocessor::getVariantKey(folderPath, defines);
+        auto variant = m_Variants.find(key);
+        if(variant != m_Variants.end())
+            return variant->second;
+
+        auto shader = Shader::create(folderPath, defines);
+        m_Variants[key] = shader;
+        return shader;
+
+    }
+
+    bool ShaderLibrary::isReady() const {
+
+        /* Check every shader, so each one that is done gets finished */
+        bool ready = true;
+        for(auto& kv : m_Shaders)
+            ready = kv.second->isReady() && ready;
+        for(auto& kv : m_Variants)
+            ready = kv.second->isReady() && ready;
+        return ready;
+
+    }
+
     Ref <Shader> ShaderLibrary::get(const std::string &name) {
         GEOGL_PROFILE_FUNCTION();
 
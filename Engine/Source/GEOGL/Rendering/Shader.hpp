@@ -26,6 +26,8 @@
 #ifndef GEOGL_SHADER_HPP
 #define GEOGL_SHADER_HPP
 
+#include "ShaderPreprocessor.hpp"
+
 namespace GEOGL{
 
     /**
@@ -43,20 +45,157 @@ namespace GEOGL{
         INT2,
         INT3,
         INT4,
-        BOOLEAN
+        BOOLEAN,
+
+        /* Compact vertex attribute types. Read as floats when normalized, and as integers otherwise */
+        UINT,
+        UBYTE4,
+        USHORT,
+        USHORT2,
+
+        /* A 16 bit float, read as a float */
+        HALF
     };
 
     /**
      * \brief Gets the size (in bytes) of each ShaderDataType
      * @param type The ShaderDataType to check
-     * @return The size in bytes of the ShaderDataType
+     * @return The size in bytes of the ShaderDataType, or 0 for NONE
+     */
+    constexpr uint32_t shaderDataTypeSize(ShaderDataType type){
+        switch(type){
+            case ShaderDataType::FLOAT:
+                return 4;
+            case ShaderDataType::FLOAT2:
+                return 4*2;
+            case ShaderDataType::FLOAT3:
+                return 4*3;
+            case ShaderDataType::FLOAT4:
+                return 4*4;
+            case ShaderDataType::MAT3:
+                return 4*3*3;
+            case ShaderDataType::MAT4:
+                return 4*4*4;
+            case ShaderDataType::INT:
+                return 4;
+            case ShaderDataType::INT2:
+                return 4*2;
+            case ShaderDataType::INT3:
+                return 4*3;
+            case ShaderDataType::INT4:
+                return 4*4;
+            case ShaderDataType::BOOLEAN:
+                return 1;
+            case ShaderDataType::UINT:
+                return 4;
+            case ShaderDataType::UBYTE4:
+                return 1*4;
+            case ShaderDataType::USHORT:
+                return 2;
+            case ShaderDataType::USHORT2:
+                return 2*2;
+            case ShaderDataType::HALF:
+                return 2;
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * \brief Checks whether a ShaderDataType holds integers, which reach the shader as integers unless normalized
+     * @param type The ShaderDataType to check
+     * @return Whether the ShaderDataType holds integers
+     */
+    constexpr bool shaderDataTypeIsInteger(ShaderDataType type){
+        switch(type){
+            case ShaderDataType::INT:
+            case ShaderDataType::INT2:
+            case ShaderDataType::INT3:
+            case ShaderDataType::INT4:
+            case ShaderDataType::BOOLEAN:
+            case ShaderDataType::UINT:
+            case ShaderDataType::UBYTE4:
+            case ShaderDataType::USHORT:
+            case ShaderDataType::USHORT2:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * \brief Maps a C++ type to the ShaderDataType with the same representation, for deriving a BufferLayout from a
+     * vertex struct. Types packed into another, such as colors stored as a uint32_t of UBYTE4, have to be named.
      */
-    GEOGL_API uint32_t shaderDataTypeSize(ShaderDataType type);
+    template<typename T>
+    struct ShaderDataTypeOf{
+        static_assert(sizeof(T) == 0, "No ShaderDataType matches this type. Name it with GEOGL_VERTEX_ELEMENT_AS.");
+    };
+
+    template<> struct ShaderDataTypeOf<float>{ static constexpr ShaderDataType value = ShaderDataType::FLOAT; };
+    template<> struct ShaderDataTypeOf<glm::vec2>{ static constexpr ShaderDataType value = ShaderDataType::FLOAT2; };
+    template<> struct ShaderDataTypeOf<glm::vec3>{ static constexpr ShaderDataType value = ShaderDataType::FLOAT3; };
+    template<> struct ShaderDataTypeOf<glm::vec4>{ static constexpr ShaderDataType value = ShaderDataType::FLOAT4; };
+    template<> struct ShaderDataTypeOf<glm::mat3>{ static constexpr ShaderDataType value = ShaderDataType::MAT3; };
+    template<> struct ShaderDataTypeOf<glm::mat4>{ static constexpr ShaderDataType value = ShaderDataType::MAT4; };
+    template<> struct ShaderDataTypeOf<int32_t>{ static constexpr ShaderDataType value = ShaderDataType::INT; };
+    template<> struct ShaderDataTypeOf<glm::ivec2>{ static constexpr ShaderDataType value = ShaderDataType::INT2; };
+    template<> struct ShaderDataTypeOf<glm::ivec3>{ static constexpr ShaderDataType value = ShaderDataType::INT3; };
+    template<> struct ShaderDataTypeOf<glm::ivec4>{ static constexpr ShaderDataType value = ShaderDataType::INT4; };
+    template<> struct ShaderDataTypeOf<bool>{ static constexpr ShaderDataType value = ShaderDataType::BOOLEAN; };
+    template<> struct ShaderDataTypeOf<uint32_t>{ static constexpr ShaderDataType value = ShaderDataType::UINT; };
+    template<> struct ShaderDataTypeOf<uint16_t>{ static constexpr ShaderDataType value = ShaderDataType::USHORT; };
+
+    /**
+     * \brief Names a shader uniform by a hash of its name.
+     *
+     * Shaders reflect their uniforms into a table keyed by this hash when they are linked, so setting a uniform never
+     * looks its name up in the graphics API. A constexpr UniformID is hashed at compile time, which makes it the best
+     * way to name a uniform that is set every frame. Array elements are named as in GLSL, such as "u_Textures[3]", and
+     * the plain name of an array refers to its first element.
+     */
+    class GEOGL_API UniformID{
+    public:
+        constexpr UniformID(const char* name) : m_Hash(hash(name)) {}; // NOLINT(google-explicit-constructor)
+
+        [[nodiscard]] constexpr uint32_t getHash() const { return m_Hash; };
+        constexpr bool operator==(const UniformID& other) const { return m_Hash == other.m_Hash; };
+
+        /**
+         * \brief Hashes a uniform name with 32 bit FNV-1a
+         */
+        static constexpr uint32_t hash(const char* name){
+            uint32_t result = 2166136261u;
+            for(; *name; ++name){
+                result ^= (uint8_t) *name;
+                result *= 16777619u;
+            }
+            return result;
+        }
+
+    private:
+        uint32_t m_Hash;
+    };
 
     /**
      * \brief Represents a Shader interface. This defines all of the methods used to upload shaders.
      */
     class GEOGL_API Shader{
+    public:
+        /**
+         * \brief Counts how shaders were built since the last reset.
+         *
+         * With GEOGL_CACHE_COMPILED_SHADERS, every shader is a hit when it was loaded from the compiled shader cache,
+         * or a miss when it had to be compiled. Rejections count the misses where the cache held an entry the driver
+         * refused, which happens after a driver update.
+         */
+        struct CacheStatistics{
+            uint32_t hits = 0;
+            uint32_t misses = 0;
+            uint32_t rejections = 0;
+            uint32_t stores = 0;
+        };
+
     public:
         virtual ~Shader() =default;
 
@@ -68,16 +207,28 @@ namespace GEOGL{
          */
         virtual void unbind() const = 0;
 
-        virtual void setInt(const char * name, int value) = 0;
-        virtual void setIntArray(const char * name, int* values, uint32_t count) = 0;
-        virtual void setFloat(const char * name, float value) = 0;
-        virtual void setFloat2(const char * name, const glm::vec2& value) = 0;
-        virtual void setFloat3(const char * name, const glm::vec3& value) = 0;
-        virtual void setFloat4(const char * name, const glm::vec4& value) = 0;
-        virtual void setMat4(const char * name, const glm::mat4& value) = 0;
+        /*
+         * Uniforms are set on the shader directly, so it does not have to be bound first. Uniforms the shader does
+         * not use are ignored.
+         */
+        virtual void setInt(UniformID uniform, int value) = 0;
+        virtual void setIntArray(UniformID uniform, int* values, uint32_t count) = 0;
+        virtual void setFloat(UniformID uniform, float value) = 0;
+        virtual void setFloat2(UniformID uniform, const glm::vec2& value) = 0;
+        virtual void setFloat3(UniformID uniform, const glm::vec3& value) = 0;
+        virtual void setFloat4(UniformID uniform, const glm::vec4& value) = 0;
+        virtual void setMat4(UniformID uniform, const glm::mat4& value) = 0;
 
         virtual const std::string& getName() const = 0;
 
+        /**
+         * \brief Checks, without waiting, whether the shader has finished compiling.
+         *
+         * Shaders from createBatch may still be compiling when they are returned. Using one before it is ready is
+         * safe, but waits for it to finish.
+         */
+        virtual bool isReady() { return true; };
+
         /**
          * Creates a shader from source files.
          * \todo Change from vertexSrc and fragmentSrc to a more robust way. Maybe a struct with some bools describing the data? Just trying to think about vulkan in the future with SPIR-V and how we can implement it with OpenGL.
@@ -98,19 +249,84 @@ namespace GEOGL{
          * This method will hard crash the program with an exit code of 2.
          *
          * @param folderPath the folder to the shader resources
+         * @param defines The macros to compile this variant of the shader with, see ShaderPreprocessor
+         * @return A shared_ptr of the newly created shader. Ready for use.
+         */
+        static Ref<Shader> create(const std::string& folderPath, const ShaderDefines& defines = {});
+
+        /**
+         * Creates a shader from source in the shader.glsl format, with each stage started by a #type line. This is
+         * used for shaders generated at runtime, such as the Renderer2D texture shader, which is sized to the texture
+         * slots of the GPU.
+         *
+         * @param source The literal source of every stage
+         * @param name The Shader's name
          * @return A shared_ptr of the newly created shader. Ready for use.
          */
-        static Ref<Shader> create(const std::string& folderPath);
+        static Ref<Shader> createFromSource(const std::string& source, const std::string& name);
+
+        /**
+         * Creates shaders from several folders at once. The files are read and preprocessed on worker threads, and
+         * every shader is compiled before any of them is waited on, so the driver can compile them in parallel.
+         *
+         * @param folderPaths The folders containing each shader.glsl
+         * @return A shared_ptr for every folder, in the same order. Each may still be compiling, see isReady.
+         */
+        static std::vector<Ref<Shader>> createBatch(const std::vector<std::string>& folderPaths);
+
+        /**
+         * \brief Reads the shader.glsl inside folderPath.
+         * @param folderPath The folder containing shader.glsl
+         * @return The source, or an empty string if it could not be read.
+         */
+        static std::string readSource(const std::string& folderPath);
+
+        /**
+         * \brief Reads the shader.glsl inside folderPath, and runs it through the ShaderPreprocessor.
+         * @param folderPath The folder containing shader.glsl, which relative includes are resolved from
+         * @param defines The macros to define in every stage
+         * @return The processed source, ready to split into stages.
+         */
+        static std::string loadSource(const std::string& folderPath, const ShaderDefines& defines = {});
+
+        /**
+         * \brief Sets the folder compiled shaders are cached in. Defaults to ShaderCache in the working directory.
+         */
+        static void setCacheDirectory(const std::string& cacheDirectory);
+        static const std::string& getCacheDirectory();
+
+        static CacheStatistics getCacheStatistics();
+        static void resetCacheStatistics();
+
+        /**
+         * \brief Binds the uniform block named blockName to a binding point in every shader created after this call.
+         *
+         * This lets shaders declare shared blocks without a binding qualifier, which GLSL 330 does not have.
+         * @param blockName The name of the block, as declared in GLSL
+         * @param binding The binding point of the UniformBuffer holding the block
+         */
+        static void setUniformBlockBinding(const std::string& blockName, uint32_t binding);
+
+        /**
+         * \brief Gets the binding point set for a uniform block.
+         * @return The binding point, or -1 if none was set
+         */
+        static int32_t getUniformBlockBinding(const std::string& blockName);
 
     protected:
         inline static void setBoundID( uint32_t uuid){s_BoundShaderID = uuid; };
         inline static uint32_t getBoundID(){ return s_BoundShaderID; };
 
+    protected:
+        static CacheStatistics s_CacheStatistics;
+
     private:
         static uint32_t s_BoundShaderID;
+        static std::string s_CacheDirectory;
+        static std::unordered_map<std::string, uint32_t> s_UniformBlockBindings;
     };
 
-    class ShaderLibrary{
+    class GEOGL_API ShaderLibrary{
 
     public:
         struct ShaderInfo{
@@ -135,10 +351,36 @@ namespace GEOGL{
          */
         std::pair<std::string, Ref<Shader>> load(const std::string& name, const std::string& folderPath);
 
+        /**
+         * \brief Loads the shaders of several folders at once with Shader::createBatch, naming them by their folder.
+         * \note The shaders may still be compiling when this returns. Using one waits for it, and isReady checks
+         * whether all of them are done.
+         *
+         * @param folderPaths The paths to the folders which contain each shader.glsl
+         *
+         * @returns The name and reference of every shader loaded, in the order of folderPaths.
+         */
+        std::vector<std::pair<std::string, Ref<Shader>>> loadBatch(const std::vector<std::string>& folderPaths);
+
         Ref<Shader> get (const std::string& name);
 
+        /**
+         * \brief Gets the variant of the shader in folderPath compiled with defines, creating it the first time it is
+         * asked for. Variants are cached by ShaderPreprocessor::getVariantKey, and kept apart from the named shaders.
+         *
+         * @param folderPath The path to the folder which contains shader.glsl
+         * @param defines The macros the variant is compiled with
+         */
+        Ref<Shader> getVariant(const std::string& folderPath, const ShaderDefines& defines);
+
+        /**
+         * \brief Checks, without waiting, whether every shader in the library has finished compiling.
+         */
+        bool isReady() const;
+
     private:
         std::unordered_map<std::string, Ref<Shader>> m_Shaders{};
+        std::unordered_map<std::string, Ref<Shader>> m_Variants{};
 
     };
 
@@ -0,0 +1,348 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "ShaderPreprocessor.hpp"
+
+#include <fstream>
+
+namespace GEOGL{
+
+    /* Deep enough for any sensible shader, shallow enough to catch an include cycle the stack misses */
+    static const size_t s_MaxIncludeDepth = 32;
+
+    static std::unordered_map<std::string, std::string>& getIncludes(){
+
+        static std::unordered_map<std::string, std::string> includes = {
+                {"GEOGL/Camera.glsl", R"(/* Written once per scene by the Renderer, and shared by every shader */
+layout(std140) uniform Camera{
+    mat4 u_ProjectionViewMatrix;
+};
+)"},
+                {"GEOGL/Transform.glsl", R"(/* Written by Renderer::submit for every draw it makes */
+layout(std140) uniform Transform{
+    mat4 u_TransformMatrix;
+};
+)"},
+                {"GEOGL/Renderer2D/QuadFragment.glsl", R"(#version 330 core
+
+/* GEOGL_TEXTURED is 0 in the variant the Renderer2D draws untextured batches with */
+#ifndef GEOGL_TEXTURED
+#define GEOGL_TEXTURED 1
+#endif
+
+in vec4 v_Color;
+in vec2 v_TextureCoord;
+in float v_TilingFactor;
+in float v_TextureIndex;
+
+/* Generated by the Renderer2D to match how the GPU binds textures */
+#if GEOGL_TEXTURED
+${TEXTURE_DECLARATIONS}
+#endif
+
+layout(location = 0) out vec4 color;
+
+void main(){
+
+    vec4 texColor = v_Color;
+
+#if GEOGL_TEXTURED
+${TEXTURE_SAMPLE}
+#endif
+    color = texColor;
+}
+)"},
+                /* The Renderer2D quad shader, for QuadMode::VERTICES */
+                {"GEOGL/Renderer2D/Texture.glsl", R"(#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+layout(location = 2) in vec2 a_TextureCoord;
+layout(location = 3) in float a_TilingFactor;
+layout(location = 4) in uint a_TextureIndex;
+
+#include <GEOGL/Camera.glsl>
+
+out vec4 v_Color;
+out vec2 v_TextureCoord;
+out float v_TilingFactor;
+out float v_TextureIndex;
+
+void main(){
+    v_Color = a_Color;
+    v_TextureCoord = a_TextureCoord;
+    v_TextureIndex = float(a_TextureIndex);
+    v_TilingFactor = a_TilingFactor;
+    gl_Position = u_ProjectionViewMatrix * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#include <GEOGL/Renderer2D/QuadFragment.glsl>
+)"},
+                /* The Renderer2D quad shader for QuadMode::INSTANCED, which expands every quad into its corners */
+                {"GEOGL/Renderer2D/TextureInstanced.glsl", R"(#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Size;
+layout(location = 2) in vec2 a_Rotation;
+layout(location = 3) in vec4 a_Color;
+layout(location = 4) in vec4 a_TextureRect;
+layout(location = 5) in float a_TilingFactor;
+layout(location = 6) in float a_TextureIndex;
+
+#include <GEOGL/Camera.glsl>
+
+out vec4 v_Color;
+out vec2 v_TextureCoord;
+out float v_TilingFactor;
+out float v_TextureIndex;
+
+/* Indexed by the index buffer of a single quad: bottom left, bottom right, top right, top left */
+const vec2 c_QuadCorners[4] = vec2[4](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+
+void main(){
+    vec2 corner = c_QuadCorners[gl_VertexID];
+    vec2 scaled = corner * a_Size;
+
+    /* a_Rotation is (sin, cos) of the quad's rotation */
+    vec2 rotated = vec2(a_Rotation.y * scaled.x - a_Rotation.x * scaled.y,
+                        a_Rotation.x * scaled.x + a_Rotation.y * scaled.y);
+
+    v_Color = a_Color;
+    v_TextureCoord = mix(a_TextureRect.xy, a_TextureRect.zw, corner + 0.5);
+    v_TextureIndex = a_TextureIndex;
+    v_TilingFactor = a_TilingFactor;
+    gl_Position = u_ProjectionViewMatrix * vec4(a_Position.xy + rotated, a_Position.z, 1.0);
+}
+
+#type fragment
+#include <GEOGL/Renderer2D/QuadFragment.glsl>
+)"},
+                /* The Renderer2D tile map shader, which draws a chunk of tiles as one quad */
+                {"GEOGL/Renderer2D/TileMap.glsl", R"(#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Position;
+
+#include <GEOGL/Camera.glsl>
+uniform vec3 u_ChunkPosition;
+uniform vec2 u_ChunkSize;
+uniform vec2 u_ChunkTiles;
+
+out vec2 v_TileCoord;
+
+void main(){
+    v_TileCoord = a_Position * u_ChunkTiles;
+    gl_Position = u_ProjectionViewMatrix * vec4(u_ChunkPosition.xy + a_Position * u_ChunkSize, u_ChunkPosition.z, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+in vec2 v_TileCoord;
+
+/* The tiles of the chunk, one per texel, with the low byte in red and the high byte in green */
+uniform sampler2D u_Tiles;
+uniform sampler2D u_TextureAtlas;
+uniform int u_AtlasColumns;
+uniform vec2 u_CellSize;
+
+layout(location = 0) out vec4 color;
+
+void main(){
+
+    ivec2 tileTexel = min(ivec2(v_TileCoord), textureSize(u_Tiles, 0) - 1);
+    vec4 tile = texelFetch(u_Tiles, tileTexel, 0);
+    int tileIndex = int(tile.r * 255.0 + 0.5) + int(tile.g * 255.0 + 0.5) * 256;
+    if(tileIndex == 0)
+        discard;
+
+    tileIndex -= 1;
+    vec2 cell = vec2(tileIndex % u_AtlasColumns, tileIndex / u_AtlasColumns);
+
+    /* Stay half a texel inside of the cell, so filtering never bleeds in from the neighbouring cells */
+    vec2 halfTexel = 0.5 / vec2(textureSize(u_TextureAtlas, 0));
+    vec2 textureCoord = cell * u_CellSize + clamp(fract(v_TileCoord) * u_CellSize, halfTexel, u_CellSize - halfTexel);
+
+    /* The coordinate jumps between cells, so take the derivatives from the continuous one */
+    vec2 continuousCoord = v_TileCoord * u_CellSize;
+    color = textureGrad(u_TextureAtlas, textureCoord, dFdx(continuousCoord), dFdy(continuousCoord));
+}
+)"}
+        };
+        return includes;
+
+    }
+
+    static std::string readFile(const std::string& filePath, bool& found){
+
+        std::ifstream in(filePath, std::ios::in | std::ios::binary);
+        found = (bool) in;
+        if(!in)
+            return "";
+
+        std::stringstream contents;
+        contents << in.rdbuf();
+        return contents.str();
+
+    }
+
+    static std::string directoryOf(const std::string& filePath){
+
+        auto lastSlash = filePath.find_last_of("/\\");
+        return lastSlash == std::string::npos ? "." : filePath.substr(0, lastSlash);
+
+    }
+
+    std::string ShaderPreprocessor::process(const std::string& source, const std::string& directory, const ShaderDefines& defines) {
+        GEOGL_PROFILE_FUNCTION();
+
+        std::string expanded;
+        expanded.reserve(source.size());
+        std::vector<std::string> includeStack;
+        expandIncludes(source, directory, expanded, includeStack);
+
+        return defines.empty() ? expanded : insertDefines(expanded, defines);
+
+    }
+
+    void ShaderPreprocessor::registerInclude(const std::string& name, const std::string& source) {
+
+        getIncludes()[name] = source;
+
+    }
+
+    std::string ShaderPreprocessor::getVariantKey(const std::string& name, const ShaderDefines& defines) {
+
+        std::string key = name;
+        for(auto& [define, value] : defines){
+            key += '|';
+            key += define;
+            key += '=';
+            key += value;
+        }
+        return key;
+
+    }
+
+    void ShaderPreprocessor::expandIncludes(const std::string& source, const std::string& directory, std::string& output, std::vector<std::string>& includeStack) {
+
+        size_t lineStart = 0;
+        while(lineStart < source.size()){
+            size_t lineEnd = source.find('\n', lineStart);
+            lineEnd = lineEnd == std::string::npos ? source.size() : lineEnd + 1;
+
+            size_t directive = source.find_first_not_of(" \t", lineStart);
+            if(directive >= lineEnd || source.compare(directive, 8, "#include") != 0){
+                output.append(source, lineStart, lineEnd - lineStart);
+                lineStart = lineEnd;
+                continue;
+            }
+
+            /* Find the name between the quotes or angle brackets */
+            size_t nameStart = source.find_first_of("\"<", directive + 8);
+            char closing = nameStart < lineEnd && source[nameStart] == '<' ? '>' : '"';
+            size_t nameEnd = nameStart < lineEnd ? source.find(closing, nameStart + 1) : std::string::npos;
+            if(nameEnd >= lineEnd){
+                GEOGL_CORE_ERROR_NOSTRIP("Malformed shader include: {}", source.substr(lineStart, lineEnd - lineStart));
+                lineStart = lineEnd;
+                continue;
+            }
+            std::string name = source.substr(nameStart + 1, nameEnd - nameStart - 1);
+            lineStart = lineEnd;
+
+            bool found;
+            std::string includeKey;
+            std::string includeSource;
+            std::string includeDirectory;
+            if(closing == '>'){
+                auto& includes = getIncludes();
+                auto include = includes.find(name);
+                found = include != includes.end();
+                if(found)
+                    includeSource = include->second;
+                includeKey = "<" + name + ">";
+                includeDirectory = directory;
+            }else{
+                includeKey = directory + "/" + name;
+                includeSource = readFile(includeKey, found);
+                includeDirectory = directoryOf(includeKey);
+            }
+
+            /* Reported rather than asserted, so a shader with a broken include can be fixed and reloaded */
+            if(!found){
+                GEOGL_CORE_ERROR_NOSTRIP("Could not resolve shader include {} from {}", name, directory);
+                continue;
+            }
+
+            bool cycle = std::find(includeStack.begin(), includeStack.end(), includeKey) != includeStack.end();
+            if(cycle || includeStack.size() >= s_MaxIncludeDepth){
+                GEOGL_CORE_ERROR_NOSTRIP("Shader include {} includes itself", includeKey);
+                continue;
+            }
+
+            includeStack.push_back(includeKey);
+            expandIncludes(includeSource, includeDirectory, output, includeStack);
+            includeStack.pop_back();
+
+            if(!output.empty() && output.back() != '\n')
+                output += '\n';
+        }
+
+    }
+
+    std::string ShaderPreprocessor::insertDefines(const std::string& source, const ShaderDefines& defines) {
+
+        std::string defineBlock;
+        for(auto& [define, value] : defines){
+            defineBlock += GEOGL_FORMAT("#define {} {}\n", define, value);
+        }
+
+        /* GLSL needs #version first, so the defines go straight after it, once in every stage */
+        std::string result;
+        result.reserve(source.size() + defineBlock.size() * 2);
+        size_t lineStart = 0;
+        while(lineStart < source.size()){
+            size_t lineEnd = source.find('\n', lineStart);
+            lineEnd = lineEnd == std::string::npos ? source.size() : lineEnd + 1;
+
+            result.append(source, lineStart, lineEnd - lineStart);
+
+            size_t directive = source.find_first_not_of(" \t", lineStart);
+            if(directive < lineEnd && source.compare(directive, 8, "#version") == 0){
+                if(result.back() != '\n')
+                    result += '\n';
+                result += defineBlock;
+            }
+
+            lineStart = lineEnd;
+        }
+
+        return result;
+
+    }
+
+}
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_SHADERPREPROCESSOR_HPP
+#define GEOGL_SHADERPREPROCESSOR_HPP
+
+namespace GEOGL{
+
+    /**
+     * \brief The macros a shader variant is compiled with, by name. Ordered, so equal sets give equal variant keys.
+     */
+    using ShaderDefines = std::map<std::string, std::string>;
+
+    /**
+     * \brief Expands the source of a shader.glsl before it is split into stages and compiled.
+     *
+     * Two forms of include are resolved, recursively:
+     * \code
+     * #include "Common/Lighting.glsl"   // relative to the folder of the file including it
+     * #include <GEOGL/Camera.glsl>       // built into the engine, or added with registerInclude
+     * \endcode
+     * The defines of a variant are inserted after every #version line, so each stage sees them, and shaders select
+     * features with #if. The engine includes are:
+     * - GEOGL/Camera.glsl, the Camera uniform block the Renderer writes once per scene
+     * - GEOGL/Transform.glsl, the Transform uniform block Renderer::submit writes for every draw
+     * - GEOGL/Renderer2D/QuadFragment.glsl, the fragment stage of the Renderer2D quad shaders
+     * - GEOGL/Renderer2D/Texture.glsl, TextureInstanced.glsl and TileMap.glsl, the whole Renderer2D shaders, which
+     *   the Renderer2D compiles from here rather than from the application's resources. An application can replace
+     *   one with registerInclude before the Renderer is initialized.
+     */
+    class GEOGL_API ShaderPreprocessor{
+    public:
+        /**
+         * \brief Resolves the includes of source and adds the defines.
+         * @param source The source to process
+         * @param directory The folder relative includes of source are resolved from
+         * @param defines The macros to define in every stage
+         * @return The processed source. Includes that can not be resolved are reported, and left out.
+         */
+        static std::string process(const std::string& source, const std::string& directory, const ShaderDefines& defines = {});
+
+        /**
+         * \brief Makes source available to every shader as #include <name>, replacing any include of that name.
+         */
+        static void registerInclude(const std::string& name, const std::string& source);
+
+        /**
+         * \brief Builds the key a variant is cached under, such as "Shaders/Texture|GEOGL_TEXTURED=0".
+         */
+        static std::string getVariantKey(const std::string& name, const ShaderDefines& defines);
+
+    private:
+        static void expandIncludes(const std::string& source, const std::string& directory, std::string& output, std::vector<std::string>& includeStack);
+        static std::string insertDefines(const std::string& source, const ShaderDefines& defines);
+
+    };
+
+}
+
+#endif //GEOGL_SHADERPREPROCESSOR_HPP
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include "SkylinePacker.hpp"
+
+namespace GEOGL{
+
+    SkylinePacker::SkylinePacker(uint32_t width, uint32_t height) :
+        m_Width(width), m_Height(height){
+
+        reset();
+
+    }
+
+    void SkylinePacker::reset() {
+
+        m_Skyline.clear();
+        m_Skyline.push_back({0, 0, m_Width});
+        m_UsedArea = 0;
+
+    }
+
+    uint32_t SkylinePacker::findFit(size_t segmentIndex, uint32_t width, uint32_t height) const {
+
+        uint32_t x = m_Skyline[segmentIndex].x;
+        if(width > m_Width - x)
+            return std::numeric_limits<uint32_t>::max();
+
+        /* The rectangle rests on the highest segment it spans */
+        uint32_t y = 0;
+        uint32_t widthLeft = width;
+        for(size_t i = segmentIndex; widthLeft > 0; ++i){
+            y = std::max(y, m_Skyline[i].y);
+            if(height > m_Height - y)
+                return std::numeric_limits<uint32_t>::max();
+
+            widthLeft -= std::min(widthLeft, m_Skyline[i].width);
+        }
+
+        return y;
+
+    }
+
+    bool SkylinePacker::insert(uint32_t width, uint32_t height, glm::uvec2& position) {
+        GEOGL_PROFILE_FUNCTION();
+
+        if(width == 0 || height == 0 || width > m_Width || height > m_Height)
+            return false;
+
+        /* Bottom left: the lowest top edge wins, and of those, the one leaving the narrowest segment under it */
+        size_t bestIndex = m_Skyline.size();
+        uint32_t bestTop = std::numeric_limits<uint32_t>::max();
+        uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+        uint32_t bestY = 0;
+
+        for(size_t i = 0; i < m_Skyline.size(); ++i){
+            uint32_t y = findFit(i, width, height);
+            if(y == std::numeric_limits<uint32_t>::max())
+                continue;
+
+            uint32_t top = y + height;
+            if(top < bestTop || (top == bestTop && m_Skyline[i].width < bestWidth)){
+                bestIndex = i;
+                bestTop = top;
+                bestWidth = m_Skyline[i].width;
+                bestY = y;
+            }
+        }
+
+        if(bestIndex == m_Skyline.size())
+            return false;
+
+        position = {m_Skyline[bestIndex].x, bestY};
+
+        /* Raise the skyline under the rectangle, cutting back the segments it covers */
+        m_Skyline.insert(m_Skyline.begin() + (ptrdiff_t)bestIndex, {position.x, bestTop, width});
+
+        uint32_t right = position.x + width;
+        for(size_t i = bestIndex + 1; i < m_Skyline.size();){
+            Segment& segment = m_Skyline[i];
+            if(segment.x >= right)
+                break;
+
+            uint32_t segmentRight = segment.x + segment.width;
+            if(segmentRight <= right){
+                m_Skyline.erase(m_Skyline.begin() + (ptrdiff_t)i);
+                continue;
+            }
+
+            segment.width = segmentRight - right;
+            segment.x = right;
+            break;
+        }
+
+        /* Merge neighbours at the same height, so the skyline stays short */
+        for(size_t i = 0; i + 1 < m_Skyline.size();){
+            if(m_Skyline[i].y == m_Skyline[i + 1].y){
+                m_Skyline[i].width += m_Skyline[i + 1].width;
+                m_Skyline.erase(m_Skyline.begin() + (ptrdiff_t)i + 1);
+            }else{
+                ++i;
+            }
+        }
+
+        m_UsedArea += (uint64_t)width * height;
+        return true;
+
+    }
+
+}
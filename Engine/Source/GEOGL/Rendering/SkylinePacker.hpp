@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#ifndef GEOGL_SKYLINEPACKER_HPP
+#define GEOGL_SKYLINEPACKER_HPP
+
+namespace GEOGL{
+
+    /**
+     * \brief Packs rectangles into a fixed size area with the skyline bottom left heuristic.
+     *
+     * The packer only tracks the top edge of what has been placed so far, as a list of horizontal segments, so every
+     * insertion is linear in the number of segments. Rectangles are never rotated, and can be inserted at any time.
+     */
+    class GEOGL_API SkylinePacker{
+    public:
+        SkylinePacker(uint32_t width, uint32_t height);
+
+        /**
+         * \brief Finds room for a width by height rectangle, and reserves it.
+         * @param width The width of the rectangle
+         * @param height The height of the rectangle
+         * @param position Set to the bottom left corner of the rectangle, if it fits
+         * @return Whether the rectangle fit
+         */
+        bool insert(uint32_t width, uint32_t height, glm::uvec2& position);
+
+        /**
+         * \brief Forgets every rectangle inserted so far.
+         */
+        void reset();
+
+        [[nodiscard]] inline uint32_t getWidth() const { return m_Width; };
+        [[nodiscard]] inline uint32_t getHeight() const { return m_Height; };
+
+        /**
+         * \brief Gets the area of every rectangle inserted so far.
+         */
+        [[nodiscard]] inline uint64_t getUsedArea() const { return m_UsedArea; };
+
+    private:
+        /**
+         * \brief A segment of the skyline, from x to x + width, with everything below y taken.
+         */
+        struct Segment{
+            uint32_t x;
+            uint32_t y;
+            uint32_t width;
+        };
+
+        /**
+         * \brief Finds the height a rectangle would sit at if placed at the start of a segment.
+         * @return The height, or UINT32_MAX if the rectangle does not fit there
+         */
+        uint32_t findFit(size_t segmentIndex, uint32_t width, uint32_t height) const;
+
+    private:
+        uint32_t m_Width;
+        uint32_t m_Height;
+        uint64_t m_UsedArea = 0;
+
+        std::vector<Segment> m_Skyline;
+    };
+
+}
+
+#endif //GEOGL_SKYLINEPACKER_HPP
@@ -32,8 +32,23 @@
 #include "../../Platform/OpenGL/Rendering/OpenGLTexture.hpp"
 #endif
 
+#if GEOGL_BUILD_WITH_NULL == 1
+#include "../../Platform/Null/Rendering/NullTexture.hpp"
+#endif
+
 namespace GEOGL{
 
+    /**
+     * \brief The textures that handles can be resolved to, indexed by renderer ID.
+     */
+    struct RegisteredTexture{
+        std::weak_ptr<Texture2D> texture;
+        uint32_t generation = 0;
+    };
+
+    static std::vector<RegisteredTexture> s_RegisteredTextures;
+    static uint32_t s_NextTextureGeneration = 1;
+
     Ref <Texture2D> Texture2D::create(uint32_t width, uint32_t height) {
         GEOGL_PROFILE_FUNCTION();
 
@@ -44,9 +59,18 @@ namespace GEOGL{
             case RendererAPI::RENDERING_OPENGL_DESKTOP:
 #if GEOGL_BUILD_WITH_OPENGL == 1
                 result = createRef<GEOGL::Platform::OpenGL::Texture2D>(width, height);
+                registerTexture(result);
                 return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::Texture2D>(width, height);
+                registerTexture(result);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} shader. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
@@ -65,9 +89,18 @@ namespace GEOGL{
             case RendererAPI::RENDERING_OPENGL_DESKTOP:
 #if GEOGL_BUILD_WITH_OPENGL == 1
                 result = createRef<GEOGL::Platform::OpenGL::Texture2D>(filePath);
+                registerTexture(result);
                 return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::Texture2D>(filePath);
+                registerTexture(result);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} shader. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
@@ -75,5 +108,29 @@ namespace GEOGL{
         }
     }
 
+    Ref<Texture2D> Texture2D::resolve(TextureHandle handle) {
+
+        if(handle.rendererID >= s_RegisteredTextures.size())
+            return nullptr;
+
+        const auto& registeredTexture = s_RegisteredTextures[handle.rendererID];
+        if(registeredTexture.generation != handle.generation)
+            return nullptr;
+
+        return registeredTexture.texture.lock();
+
+    }
+
+    void Texture2D::registerTexture(const Ref<Texture2D>& texture) {
+
+        uint32_t rendererID = texture->getRendererID();
+        texture->m_Handle = {rendererID, s_NextTextureGeneration++};
+
+        if(rendererID >= s_RegisteredTextures.size())
+            s_RegisteredTextures.resize(rendererID + 1);
+
+        s_RegisteredTextures[rendererID] = {texture, texture->m_Handle.generation};
+
+    }
 
-}
\ No newline at end of file
+}
@@ -28,6 +28,22 @@
 
 namespace GEOGL{
 
+    /**
+     * \brief A lightweight, non owning reference to a Texture2D.
+     *
+     * The generation is unique to every texture ever created, so a handle to a texture that has since been destroyed
+     * never resolves to a new texture that happens to reuse its renderer ID.
+     */
+    struct GEOGL_API TextureHandle{
+        uint32_t rendererID = 0;
+        uint32_t generation = 0;
+
+        [[nodiscard]] inline bool isValid() const { return generation != 0; };
+
+        inline bool operator==(const TextureHandle& other) const { return rendererID == other.rendererID && generation == other.generation; };
+        inline bool operator!=(const TextureHandle& other) const { return !(*this == other); };
+    };
+
     /**
      * Defines the abstract form of a texture
      */
@@ -42,11 +58,35 @@ namespace GEOGL{
 
         virtual void setData(void* data, uint32_t size) = 0;
 
+        /**
+         * \brief Replaces a region of the texture.
+         * @param data The texels of the region, in the format of the texture, starting at the bottom row
+         * @param x The left edge of the region
+         * @param y The bottom edge of the region
+         * @param width The width of the region
+         * @param height The height of the region
+         */
+        virtual void setSubData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+
         /**
          * Binds the texture for rendering
          */
         virtual void bind(uint32_t slotID) const = 0;
 
+        /**
+         * \brief Gets a counter bumped whenever the contents of the texture change, so copies of the texture can tell
+         * when they are stale.
+         */
+        [[nodiscard]] inline uint32_t getContentVersion() const { return m_ContentVersion; };
+
+        /**
+         * \brief Records that the contents of the texture changed. setData and setSubData do this themselves, so it is
+         * only needed when the texture is written some other way, such as by rendering into it.
+         */
+        inline void markContentChanged() { ++m_ContentVersion; };
+
+    private:
+        uint32_t m_ContentVersion = 0;
 
     };
 
@@ -56,8 +96,28 @@ namespace GEOGL{
         static Ref<Texture2D> create(uint32_t width, uint32_t height);
         static Ref<Texture2D> create(const std::string& filePath);
 
+        /**
+         * \brief Gets the owning reference to the texture a handle refers to.
+         * @param handle The handle to resolve
+         * @return The texture, or nullptr if it has been destroyed
+         */
+        static Ref<Texture2D> resolve(TextureHandle handle);
+
+        /**
+         * \brief Gets a non owning handle to this texture, which can be passed around without touching the refcount.
+         */
+        [[nodiscard]] inline TextureHandle getHandle() const { return m_Handle; };
+
         virtual bool operator==(const Texture2D& other) const = 0;
 
+    private:
+        /**
+         * \brief Assigns the texture its handle, and records it so the handle can be resolved later.
+         */
+        static void registerTexture(const Ref<Texture2D>& texture);
+
+        TextureHandle m_Handle;
+
     };
 
 }
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include "TextureAtlasBuilder.hpp"
+#include "RenderCommand.hpp"
+
+namespace GEOGL{
+
+    TextureAtlasBuilder::TextureAtlasBuilder(uint32_t pageSize, uint32_t padding) :
+        m_PageSize(std::min(std::max(pageSize, 1u), RenderCommand::getCapabilities().maxTextureSize)), m_Padding(padding){
+
+    }
+
+    Ref<SubTexture2D> TextureAtlasBuilder::add(const std::string& filePath) {
+        GEOGL_PROFILE_FUNCTION();
+
+        int width, height, channels;
+        stbi_uc* data = nullptr;
+        {
+            GEOGL_PROFILE_SCOPE("Load image from file");
+            stbi_set_flip_vertically_on_load(true);
+            data = stbi_load(filePath.c_str(), &width, &height, &channels, 4);
+            GEOGL_CORE_ASSERT_NOSTRIP(data, "Failed to load image {}", filePath);
+        }
+
+        if(!data)
+            return nullptr;
+
+        Ref<SubTexture2D> subTexture = add(data, (uint32_t)width, (uint32_t)height);
+        stbi_image_free(data);
+
+        return subTexture;
+
+    }
+
+    Ref<SubTexture2D> TextureAtlasBuilder::add(const void* pixels, uint32_t width, uint32_t height) {
+        GEOGL_PROFILE_FUNCTION();
+
+        uint32_t paddedWidth = width + 2 * m_Padding;
+        uint32_t paddedHeight = height + 2 * m_Padding;
+
+        if(paddedWidth > m_PageSize || paddedHeight > m_PageSize){
+            GEOGL_CORE_WARN("A {} by {} image does not fit into a {} by {} atlas page, so it gets a texture of its own.", width, height, m_PageSize, m_PageSize);
+
+            Ref<Texture2D> texture = Texture2D::create(width, height);
+            texture->setData(const_cast<void*>(pixels), width * height * 4);
+            return createRef<SubTexture2D>(texture, glm::vec2{0,0}, glm::vec2{1,1});
+        }
+
+        /* Try the newest page first, as the older ones are the most likely to be full */
+        glm::uvec2 position;
+        Page* page = nullptr;
+        for(auto it = m_Pages.rbegin(); it != m_Pages.rend(); ++it){
+            if(it->packer.insert(paddedWidth, paddedHeight, position)){
+                page = &*it;
+                break;
+            }
+        }
+
+        if(!page){
+            m_Pages.push_back({Texture2D::create(m_PageSize, m_PageSize), SkylinePacker(m_PageSize, m_PageSize)});
+            page = &m_Pages.back();
+
+            bool inserted = page->packer.insert(paddedWidth, paddedHeight, position);
+            GEOGL_CORE_ASSERT(inserted, "A {} by {} image did not fit into an empty atlas page.", paddedWidth, paddedHeight);
+        }
+
+        padImage(static_cast<const uint32_t*>(pixels), width, height);
+        page->texture->setSubData(m_PaddedPixels.data(), position.x, position.y, paddedWidth, paddedHeight);
+
+        auto pageSize = (float)m_PageSize;
+        glm::vec2 minBound = {(float)(position.x + m_Padding) / pageSize, (float)(position.y + m_Padding) / pageSize};
+        glm::vec2 maxBound = {(float)(position.x + m_Padding + width) / pageSize, (float)(position.y + m_Padding + height) / pageSize};
+
+        return createRef<SubTexture2D>(page->texture, minBound, maxBound);
+
+    }
+
+    void TextureAtlasBuilder::padImage(const uint32_t* pixels, uint32_t width, uint32_t height) {
+
+        uint32_t paddedWidth = width + 2 * m_Padding;
+        uint32_t paddedHeight = height + 2 * m_Padding;
+        m_PaddedPixels.resize((size_t)paddedWidth * paddedHeight);
+
+        /* Every texel of the padding repeats the closest edge texel of the image */
+        uint32_t* destination = m_PaddedPixels.data();
+        for(uint32_t y = 0; y < paddedHeight; ++y){
+            uint32_t sourceY = std::min(y > m_Padding ? y - m_Padding : 0, height - 1);
+            const uint32_t* sourceRow = pixels + (size_t)sourceY * width;
+
+            for(uint32_t x = 0; x < paddedWidth; ++x){
+                uint32_t sourceX = std::min(x > m_Padding ? x - m_Padding : 0, width - 1);
+                *destination++ = sourceRow[sourceX];
+            }
+        }
+
+    }
+
+}
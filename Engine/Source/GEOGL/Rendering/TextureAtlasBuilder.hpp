@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#ifndef GEOGL_TEXTUREATLASBUILDER_HPP
+#define GEOGL_TEXTUREATLASBUILDER_HPP
+
+#include "Texture.hpp"
+#include "SubTexture2D.hpp"
+#include "SkylinePacker.hpp"
+
+namespace GEOGL{
+
+    /**
+     * \brief Packs loose images into shared atlas textures at load time, so sprites and icons loaded one by one can be
+     * drawn in the same batch.
+     *
+     * Every image is packed as soon as it is added and uploaded straight into its atlas, so images can be added at
+     * any time, and the SubTexture2D of an image stays valid as more are added. A new atlas page is started whenever
+     * an image does not fit into the existing ones.
+     */
+    class GEOGL_API TextureAtlasBuilder{
+    public:
+        /**
+         * \brief Creates a builder with no pages yet.
+         * @param pageSize The width and height of every atlas texture, clamped to the largest texture the GPU supports
+         * @param padding The border around every image, filled by extending its edge texels, so that filtering never
+         * bleeds in from the neighbouring images
+         */
+        explicit TextureAtlasBuilder(uint32_t pageSize = 2048, uint32_t padding = 2);
+
+        /**
+         * \brief Loads an image and packs it into an atlas.
+         * @param filePath The image to load
+         * @return The image in its atlas, or nullptr if it failed to load
+         */
+        Ref<SubTexture2D> add(const std::string& filePath);
+
+        /**
+         * \brief Packs an image into an atlas.
+         *
+         * Images larger than a page are not packed, and get a texture of their own instead.
+         *
+         * @param pixels The RGBA8 texels of the image, starting at the bottom row
+         * @param width The width of the image
+         * @param height The height of the image
+         * @return The image in its atlas
+         */
+        Ref<SubTexture2D> add(const void* pixels, uint32_t width, uint32_t height);
+
+        [[nodiscard]] inline size_t getPageCount() const { return m_Pages.size(); };
+        [[nodiscard]] inline const Ref<Texture2D>& getPage(size_t page) const { return m_Pages[page].texture; };
+        [[nodiscard]] inline uint32_t getPageSize() const { return m_PageSize; };
+
+    private:
+        struct Page{
+            Ref<Texture2D> texture;
+            SkylinePacker packer;
+        };
+
+        /**
+         * \brief Copies the image into m_PaddedPixels, with its edges extended by the padding on every side.
+         */
+        void padImage(const uint32_t* pixels, uint32_t width, uint32_t height);
+
+    private:
+        uint32_t m_PageSize;
+        uint32_t m_Padding;
+
+        std::vector<Page> m_Pages;
+
+        /* Scratch storage for the padded image, kept to avoid allocating every call */
+        std::vector<uint32_t> m_PaddedPixels;
+    };
+
+}
+
+#endif //GEOGL_TEXTUREATLASBUILDER_HPP
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "TextureTable.hpp"
+
+#include <memory>
+#include "Renderer.hpp"
+#include "RenderCommand.hpp"
+
+#if GEOGL_BUILD_WITH_OPENGL == 1
+#include "../../Platform/OpenGL/Rendering/OpenGLTextureTable.hpp"
+#endif
+
+namespace GEOGL{
+
+    bool TextureTable::isSupported(Type type) {
+
+        const RenderCaps& caps = RenderCommand::getCapabilities();
+
+        switch(Renderer::getRendererAPI()->getRenderingAPI()){
+            case RendererAPI::RENDERING_OPENGL_DESKTOP:
+                switch(type){
+                    case Type::TEXTURE_ARRAYS:
+                        return caps.copyImage;
+                    case Type::BINDLESS:
+                        return caps.bindlessTexture && caps.maxShaderStorageBlockSize > 0;
+                    default:
+                        return false;
+                }
+            default:
+                return false;
+        }
+
+    }
+
+    Ref<TextureTable> TextureTable::create(Type type, uint32_t textureUnits) {
+        GEOGL_PROFILE_FUNCTION();
+
+        GEOGL_CORE_ASSERT(isSupported(type), "Tried to create a texture table the RendererAPI does not support.");
+
+        const auto renderer = Renderer::getRendererAPI();
+
+        Ref<TextureTable> result;
+        switch(renderer->getRenderingAPI()){
+            case RendererAPI::RENDERING_OPENGL_DESKTOP:
+#if GEOGL_BUILD_WITH_OPENGL == 1
+                if(type == Type::BINDLESS)
+                    result = createRef<GEOGL::Platform::OpenGL::BindlessTextureTable>();
+                else
+                    result = createRef<GEOGL::Platform::OpenGL::TextureArrayTable>(textureUnits);
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            default:
+                GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} texture table. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
+                return result;
+        }
+
+    }
+
+}
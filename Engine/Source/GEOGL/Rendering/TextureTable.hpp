@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_TEXTURETABLE_HPP
+#define GEOGL_TEXTURETABLE_HPP
+
+#include "Texture.hpp"
+#include "Shader.hpp"
+
+namespace GEOGL{
+
+    /**
+     * \brief Makes many textures addressable from a single draw, so a batch is not limited by the texture units of the
+     * GPU.
+     *
+     * A batch adds every texture it draws with once, and writes the returned index into its vertices. The shader code
+     * from getShaderDeclarations and getShaderSampleCode turns the index back into a texel. The sample code multiplies
+     * texColor by the texel at v_TextureCoord * v_TilingFactor of texture v_TextureIndex.
+     */
+    class GEOGL_API TextureTable{
+    public:
+        enum class GEOGL_API Type{
+            /**
+             * Textures are copied into the layers of texture arrays shared by every texture of the same size and
+             * format, so a batch only runs out of texture units once it uses more sizes than there are units.
+             */
+            TEXTURE_ARRAYS = 0,
+
+            /**
+             * Textures are referenced by bindless handles stored in a shader storage buffer, so a batch only runs out
+             * once the buffer is full.
+             */
+            BINDLESS
+        };
+
+    public:
+        virtual ~TextureTable() = default;
+
+        /**
+         * \brief Adds a texture to the current batch.
+         * @param texture The texture to add
+         * @return The index to write into the vertices, or -1 if the batch has to be flushed first.
+         */
+        virtual int32_t add(const Ref<Texture2D>& texture) = 0;
+
+        /**
+         * \brief Makes the textures of the current batch available to the shader. Call right before drawing.
+         */
+        virtual void bind() = 0;
+
+        /**
+         * \brief Starts a new batch.
+         */
+        virtual void reset() = 0;
+
+        /**
+         * \brief Sets up the uniforms the declarations need. The shader must be bound.
+         */
+        virtual void setUpShader(const Ref<Shader>& shader) = 0;
+
+        /**
+         * \brief Gets the shading language version the declarations need, such as "330 core".
+         */
+        [[nodiscard]] virtual std::string getShaderVersion() const = 0;
+
+        /**
+         * \brief Gets the extension directives the declarations need, to be placed right after the version.
+         */
+        [[nodiscard]] virtual std::string getShaderExtensions() const = 0;
+
+        [[nodiscard]] virtual std::string getShaderDeclarations() const = 0;
+        [[nodiscard]] virtual std::string getShaderSampleCode() const = 0;
+
+        /**
+         * \brief Checks if the RendererAPI can create a table of type. Must be called after RendererAPI::init.
+         */
+        static bool isSupported(Type type);
+
+        /**
+         * \brief Creates a texture table
+         * @param type The type of table. Must be supported.
+         * @param textureUnits The texture units the table may bind for each batch
+         * @return The table
+         */
+        static Ref<TextureTable> create(Type type, uint32_t textureUnits);
+
+    };
+
+}
+
+#endif //GEOGL_TEXTURETABLE_HPP
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include "TileMap.hpp"
+
+namespace GEOGL{
+
+    TileMap::TileMap(uint32_t width, uint32_t height, const Ref<Texture2D>& textureAtlas, const glm::vec2& cellSize, uint32_t chunkSize) :
+        m_Width(width), m_Height(height), m_ChunkSize(std::max(chunkSize, 1u)), m_TextureAtlas(textureAtlas), m_CellSize(cellSize){
+        GEOGL_PROFILE_FUNCTION();
+
+        m_AtlasColumns = std::max((uint32_t)((float)m_TextureAtlas->getWidth() / m_CellSize.x), 1u);
+
+        m_ChunksPerRow = (m_Width + m_ChunkSize - 1) / m_ChunkSize;
+        uint32_t chunksPerColumn = (m_Height + m_ChunkSize - 1) / m_ChunkSize;
+
+        /* The chunks on the right and top edges are cut down to the size of the map */
+        m_Chunks.resize(m_ChunksPerRow * chunksPerColumn);
+        for(uint32_t y = 0; y < chunksPerColumn; ++y){
+            for(uint32_t x = 0; x < m_ChunksPerRow; ++x){
+                Chunk& chunk = m_Chunks[x + y * m_ChunksPerRow];
+                chunk.origin = {x * m_ChunkSize, y * m_ChunkSize};
+                chunk.size = {std::min(m_ChunkSize, m_Width - chunk.origin.x), std::min(m_ChunkSize, m_Height - chunk.origin.y)};
+                chunk.texels.resize(chunk.size.x * chunk.size.y);
+            }
+        }
+
+    }
+
+    uint16_t TileMap::getTileIndex(const glm::uvec2& atlasCoords) const {
+
+        uint32_t tile = 1 + atlasCoords.x + atlasCoords.y * m_AtlasColumns;
+        GEOGL_CORE_ASSERT(tile <= std::numeric_limits<uint16_t>::max(), "The atlas cell ({}, {}) is past the last tile a TileMap can hold.", atlasCoords.x, atlasCoords.y);
+
+        return (uint16_t)tile;
+
+    }
+
+    void TileMap::setTile(uint32_t x, uint32_t y, uint16_t tile) {
+
+        GEOGL_CORE_ASSERT(x < m_Width && y < m_Height, "Tried to set tile ({}, {}), which is outside of the {} by {} map.", x, y, m_Width, m_Height);
+
+        Chunk& chunk = m_Chunks[getChunkIndex(x, y)];
+        uint32_t& texel = chunk.texels[(x - chunk.origin.x) + (y - chunk.origin.y) * chunk.size.x];
+
+        /* Red and green hold the tile, and alpha is kept opaque */
+        uint32_t newTexel = tile ? (0xFF000000 | tile) : 0;
+        if(texel == newTexel)
+            return;
+
+        if(!texel) ++chunk.tileCount;
+        if(!newTexel) --chunk.tileCount;
+
+        texel = newTexel;
+        chunk.dirty = true;
+
+    }
+
+    uint16_t TileMap::getTile(uint32_t x, uint32_t y) const {
+
+        GEOGL_CORE_ASSERT(x < m_Width && y < m_Height, "Tried to get tile ({}, {}), which is outside of the {} by {} map.", x, y, m_Width, m_Height);
+
+        const Chunk& chunk = m_Chunks[getChunkIndex(x, y)];
+        return (uint16_t)(chunk.texels[(x - chunk.origin.x) + (y - chunk.origin.y) * chunk.size.x] & 0xFFFF);
+
+    }
+
+    void TileMap::uploadChunk(Chunk& chunk) {
+
+        if(!chunk.dirty)
+            return;
+
+        if(!chunk.tileTexture)
+            chunk.tileTexture = Texture2D::create(chunk.size.x, chunk.size.y);
+
+        chunk.tileTexture->setData(chunk.texels.data(), (uint32_t)(chunk.texels.size() * sizeof(uint32_t)));
+        chunk.dirty = false;
+
+    }
+
+}
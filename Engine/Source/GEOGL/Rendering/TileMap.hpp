@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#ifndef GEOGL_TILEMAP_HPP
+#define GEOGL_TILEMAP_HPP
+
+#include "Texture.hpp"
+
+namespace GEOGL{
+
+    /**
+     * \brief A grid of tiles drawn from the cells of a texture atlas, drawn with Renderer2D::drawTileMap.
+     *
+     * The map is split into square chunks, each of which keeps the tiles it holds in a small texture, so that the
+     * fragment shader looks the tiles up and every visible chunk costs a single quad, no matter how many tiles it
+     * holds. Changing a tile only uploads the chunk it is in, the next time the map is drawn.
+     *
+     * Tile 0 is empty. Any other tile is a cell of the atlas, in the same coordinates SubTexture2D::createFromCoords
+     * takes, converted with getTileIndex. Tile (0,0) is the bottom left of the map.
+     */
+    class GEOGL_API TileMap{
+    public:
+        /**
+         * \brief Creates an empty tile map.
+         * @param width The width of the map, in tiles
+         * @param height The height of the map, in tiles
+         * @param textureAtlas The atlas the tiles are drawn from
+         * @param cellSize The size of a cell of the atlas, in pixels
+         * @param chunkSize The width and height of a chunk, in tiles
+         */
+        TileMap(uint32_t width, uint32_t height, const Ref<Texture2D>& textureAtlas, const glm::vec2& cellSize, uint32_t chunkSize = 64);
+
+        /**
+         * \brief Gets the tile that draws the atlas cell at atlasCoords.
+         */
+        [[nodiscard]] uint16_t getTileIndex(const glm::uvec2& atlasCoords) const;
+
+        void setTile(uint32_t x, uint32_t y, uint16_t tile);
+        inline void setTile(uint32_t x, uint32_t y, const glm::uvec2& atlasCoords) { setTile(x, y, getTileIndex(atlasCoords)); };
+        [[nodiscard]] uint16_t getTile(uint32_t x, uint32_t y) const;
+
+        /**
+         * \brief Sets where the bottom left corner of the map is drawn, and its depth.
+         */
+        inline void setPosition(const glm::vec3& position) { m_Position = position; };
+        [[nodiscard]] inline const glm::vec3& getPosition() const { return m_Position; };
+
+        /**
+         * \brief Sets the world space size of a single tile.
+         */
+        inline void setTileSize(const glm::vec2& tileSize) { m_TileSize = tileSize; };
+        [[nodiscard]] inline const glm::vec2& getTileSize() const { return m_TileSize; };
+
+        [[nodiscard]] inline uint32_t getWidth() const { return m_Width; };
+        [[nodiscard]] inline uint32_t getHeight() const { return m_Height; };
+        [[nodiscard]] inline uint32_t getChunkSize() const { return m_ChunkSize; };
+        [[nodiscard]] inline const Ref<Texture2D>& getTextureAtlas() const { return m_TextureAtlas; };
+        [[nodiscard]] inline const glm::vec2& getCellSize() const { return m_CellSize; };
+
+    private:
+        /**
+         * \brief A chunk of the map. The tiles are stored as the texels of its texture, the low byte of the tile in
+         * red and the high byte in green.
+         */
+        struct Chunk{
+            glm::uvec2 origin;
+            glm::uvec2 size;
+            std::vector<uint32_t> texels;
+            uint32_t tileCount = 0;
+
+            Ref<Texture2D> tileTexture;
+            bool dirty = false;
+        };
+
+        [[nodiscard]] inline uint32_t getChunkIndex(uint32_t x, uint32_t y) const { return (x / m_ChunkSize) + (y / m_ChunkSize) * m_ChunksPerRow; };
+
+        /**
+         * \brief Uploads the chunk to its texture if any of its tiles changed, creating the texture the first time.
+         */
+        void uploadChunk(Chunk& chunk);
+
+    private:
+        uint32_t m_Width;
+        uint32_t m_Height;
+        uint32_t m_ChunkSize;
+        uint32_t m_ChunksPerRow;
+
+        Ref<Texture2D> m_TextureAtlas;
+        glm::vec2 m_CellSize;
+        uint32_t m_AtlasColumns;
+
+        glm::vec3 m_Position = {0.0f, 0.0f, 0.0f};
+        glm::vec2 m_TileSize = {1.0f, 1.0f};
+
+        std::vector<Chunk> m_Chunks;
+
+        friend class Renderer2D;
+    };
+
+}
+
+#endif //GEOGL_TILEMAP_HPP
@@ -33,6 +33,10 @@
 #include "../../Platform/OpenGL/Rendering/OpenGLVertexArray.hpp"
 #endif
 
+#if GEOGL_BUILD_WITH_NULL == 1
+#include "../../Platform/Null/Rendering/NullVertexArray.hpp"
+#endif
+
 namespace GEOGL{
 
     uint32_t VertexArray::s_BoundVAOID = 0;
@@ -50,6 +54,13 @@ namespace GEOGL{
                 return result;
 #else
                 GEOGL_CORE_CRITICAL("Platform OpenGL Slected but not supported.");
+#endif
+            case RendererAPI::RENDERING_NULL:
+#if GEOGL_BUILD_WITH_NULL == 1
+                result = createRef<GEOGL::Platform::Null::VertexArray>();
+                return result;
+#else
+                GEOGL_CORE_CRITICAL("Platform Null Selected but not supported.");
 #endif
             default:
                 GEOGL_CORE_CRITICAL_NOSTRIP("Unable to create a {} shader. Unhandled path.", RendererAPI::getRenderingAPIName(renderer->getRenderingAPI()));
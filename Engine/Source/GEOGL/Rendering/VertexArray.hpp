@@ -65,6 +65,20 @@ namespace GEOGL{
          */
         virtual void addVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) = 0;
 
+        /**
+         * \brief Replaces the vertex buffer read from a binding added with addVertexBuffer().
+         *
+         * The attribute formats of the binding are left untouched, so this only swaps the buffer (and its offset)
+         * the attributes are read from. That makes it a cheap way to cycle between buffers that share a layout.
+         *
+         * \note The new VertexBuffer must have the same stride as the one it replaces.
+         *
+         * @param binding The index of the binding, which is the order its vertex buffer was added in.
+         * @param vertexBuffer The VertexBuffer to read the binding from. A reference is kept with shared_ptr
+         * @param offset The offset in bytes of the first vertex in the buffer.
+         */
+        virtual void setVertexBuffer(uint32_t binding, const Ref<VertexBuffer>& vertexBuffer, uint32_t offset = 0) = 0;
+
         /**
          * \brief Sets the index buffer for this vertex array.
          *
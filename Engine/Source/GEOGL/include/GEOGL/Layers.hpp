@@ -31,6 +31,7 @@
 #include "../../Layers/Layer.hpp"
 #include "../../ImGui/ImGuiLayer.hpp"
 #include "../../Layers/LayerStack.hpp"
+#include "../../Layers/CachedLayer.hpp"
 
 
 #endif //GEOGL_LAYERS_INCLUDE_HPP
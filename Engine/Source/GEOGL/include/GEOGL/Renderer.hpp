@@ -36,11 +36,20 @@
 #include "../../Rendering/VertexArray.hpp"
 #include "../../Rendering/Buffer.hpp"
 #include "../../Rendering/Shader.hpp"
+#include "../../Rendering/ShaderPreprocessor.hpp"
 #include "../../Rendering/Camera.hpp"
 #include "../../Rendering/Texture.hpp"
 #include "../../Rendering/SubTexture2D.hpp"
 #include "../../Rendering/Renderer2D.hpp"
 #include "../../Rendering/Framebuffer.hpp"
+#include "../../Rendering/RenderCache.hpp"
+#include "../../Rendering/RenderThread.hpp"
+#include "../../Rendering/QuadVertexKernel.hpp"
+#include "../../Rendering/RadixSort.hpp"
+#include "../../Rendering/TextureTable.hpp"
+#include "../../Rendering/TileMap.hpp"
+#include "../../Rendering/SkylinePacker.hpp"
+#include "../../Rendering/TextureAtlasBuilder.hpp"
 
 
 #endif //GEOGL_RENDERER_INCLUDE_HPP
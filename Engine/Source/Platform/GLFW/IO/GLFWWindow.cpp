@@ -206,6 +206,16 @@ namespace GEOGL::Platform::GLFW{
         m_GraphicsContext->swapBuffers();
     }
 
+    void Window::waitEvents(float timeout){
+        GEOGL_PROFILE_FUNCTION();
+
+        glfwWaitEventsTimeout(timeout);
+    }
+
+    void Window::postEmptyEvent(){
+        glfwPostEmptyEvent();
+    }
+
     void Window::setVSync(bool enabled){
         GEOGL_PROFILE_FUNCTION();
 
@@ -266,6 +276,19 @@ namespace GEOGL::Platform::GLFW{
             data->EventCallback(event);
         });
 
+        glfwSetWindowFocusCallback(m_Window, [](GLFWwindow *window, int focused) {
+            GEOGL_PROFILE_FUNCTION();
+
+            auto *data = (WindowData *) glfwGetWindowUserPointer(window);
+            if(focused){
+                WindowFocusEvent event;
+                data->EventCallback(event);
+            }else{
+                WindowLostFocusEvent event;
+                data->EventCallback(event);
+            }
+        });
+
         glfwSetKeyCallback(m_Window, [](GLFWwindow *window, int key, int scancode, int action, int mods) {
             GEOGL_PROFILE_FUNCTION();
 
@@ -54,6 +54,8 @@ namespace GEOGL::Platform::GLFW{
         ~Window() override;
 
         void onUpdate() override;
+        void waitEvents(float timeout) override;
+        void postEmptyEvent() override;
 
         [[nodiscard]] inline unsigned int getWidth() const override { return m_Data.width; }
         [[nodiscard]] inline unsigned int getHeight() const override { return m_Data.height; }
@@ -85,6 +87,7 @@ namespace GEOGL::Platform::GLFW{
          * @return the GLFWwindow, cast to a void pointer
          */
         [[nodiscard]] inline void* getNativeWindow() const override { return (void*) m_Window; };
+        [[nodiscard]] inline GEOGL::GraphicsContext* getGraphicsContext() const override { return m_GraphicsContext; };
 
 
         /**
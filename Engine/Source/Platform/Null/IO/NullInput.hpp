@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLINPUT_HPP
+#define GEOGL_NULLINPUT_HPP
+
+
+#include "../../../GEOGL/IO/Input.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    /**
+     * \brief The Input of a Null Window, where nothing is ever pressed and the mouse never leaves the origin.
+     */
+    class GEOGL_API_HIDDEN Input : public GEOGL::Input{
+
+    protected:
+        inline bool isKeyPressedImpl(KeyCode keycode) override { return false; };
+
+        inline bool isMouseButtonPressedImpl(MouseCode button) override { return false; };
+        inline float getMouseXImpl() override { return 0.0f; };
+        inline float getMouseYImpl() override { return 0.0f; };
+        inline std::tuple<double, double> getMousePositionImpl() override { return {0.0, 0.0}; };
+
+    };
+
+}
+
+#endif //GEOGL_NULLINPUT_HPP
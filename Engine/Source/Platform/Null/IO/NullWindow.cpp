@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "NullWindow.hpp"
+#include "NullInput.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    Window::Window(const WindowProps& props) :
+        m_Title(props.title), m_Width(props.width), m_Height(props.height), m_CreationTime(std::chrono::steady_clock::now()){
+
+        /* Initialize Input for Window */
+        Input::init(new Input());
+
+        GEOGL_CORE_INFO("Creating headless window {0} ({1}, {2})", props.title, props.width, props.height);
+
+    }
+
+    void Window::waitEvents(float timeout){
+        GEOGL_PROFILE_FUNCTION();
+
+        std::unique_lock<std::mutex> lock(m_EventMutex);
+        m_EventPosted.wait_for(lock, std::chrono::duration<float>(timeout), [this](){ return m_PendingEvent; });
+        m_PendingEvent = false;
+
+    }
+
+    void Window::postEmptyEvent(){
+
+        {
+            std::lock_guard<std::mutex> lock(m_EventMutex);
+            m_PendingEvent = true;
+        }
+        m_EventPosted.notify_one();
+
+    }
+
+    float Window::getCurrentPlatformTime(){
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - m_CreationTime).count();
+    }
+
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLWINDOW_HPP
+#define GEOGL_NULLWINDOW_HPP
+
+#include "../../../GEOGL/IO/Window.hpp"
+
+#include <mutex>
+#include <condition_variable>
+
+namespace GEOGL::Platform::Null{
+
+    /**
+     * \brief Represents a window that is never shown, for running an Application with the Null RendererAPI.
+     *
+     * It never produces input events, so it stays open until Application::close is called.
+     */
+    class GEOGL_API Window : public GEOGL::Window{
+    public:
+        explicit Window(const WindowProps& props);
+        ~Window() override = default;
+
+        void onUpdate() override {};
+        void waitEvents(float timeout) override;
+        void postEmptyEvent() override;
+
+        [[nodiscard]] inline unsigned int getWidth() const override { return m_Width; }
+        [[nodiscard]] inline unsigned int getHeight() const override { return m_Height; }
+
+        inline void setEventCallback(const EventCallbackFn& callback) override { m_EventCallback = callback; }
+
+        inline void setVSync(bool enabled) override { m_VSync = enabled; };
+        inline void setWindowIcon(const std::string& windowIcon) override {};
+        [[nodiscard]] inline bool isVSync() const override { return m_VSync; };
+
+        /**
+         * \brief There is no native window
+         * @return nullptr
+         */
+        [[nodiscard]] inline void* getNativeWindow() const override { return nullptr; };
+
+        /**
+         * \brief Nothing is drawn, so there is no context either
+         * @return nullptr
+         */
+        [[nodiscard]] inline GEOGL::GraphicsContext* getGraphicsContext() const override { return nullptr; };
+
+        inline RendererAPI::WindowingAPIEnum type() override { return RendererAPI::WINDOWING_NULL; };
+
+        float getCurrentPlatformTime() override;
+
+    private:
+        std::string m_Title;
+        unsigned int m_Width, m_Height;
+        bool m_VSync = true;
+        EventCallbackFn m_EventCallback;
+
+        std::chrono::steady_clock::time_point m_CreationTime;
+
+        /* Lets postEmptyEvent wake up waitEvents from another thread */
+        std::mutex m_EventMutex;
+        std::condition_variable m_EventPosted;
+        bool m_PendingEvent = false;
+
+    };
+
+}
+
+#endif //GEOGL_NULLWINDOW_HPP
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "NullBuffer.hpp"
+#include "NullRendererAPI.hpp"
+
+
+namespace GEOGL::Platform::Null{
+
+
+    /*
+     * Vertex Buffer
+     */
+
+    VertexBuffer::VertexBuffer(uint32_t size) : m_RendererID(RendererAPI::generateRendererID()), m_Size(size){
+
+    }
+
+    VertexBuffer::VertexBuffer(float* vertices, uint32_t size) : m_RendererID(RendererAPI::generateRendererID()), m_Size(size){
+
+        RendererAPI::getRecording().vertexBytes += size;
+
+    }
+
+    void VertexBuffer::bind() const {
+
+        if(RendererAPI::bindVertexBuffer(m_RendererID))
+            ++RendererAPI::getRecording().bufferBinds;
+
+    }
+
+    void VertexBuffer::unbind() const {
+
+    }
+
+    void VertexBuffer::setData(const void* data, uint32_t size) {
+
+        GEOGL_CORE_ASSERT(size <= m_Size, "Tried to write {} bytes to a vertex buffer of {} bytes.", size, m_Size);
+        RendererAPI::getRecording().vertexBytes += size;
+
+    }
+
+
+    /*
+     * Stream Vertex Buffer
+     */
+
+    StreamVertexBuffer::StreamVertexBuffer(uint32_t regionSize, uint32_t regionCount) : m_RendererID(RendererAPI::generateRendererID()), m_RegionSize(regionSize){
+
+        /* Nothing reads the regions back, so a single one is enough no matter how many were asked for */
+        m_StagingBuffer = std::make_unique<uint8_t[]>(m_RegionSize);
+
+    }
+
+    void StreamVertexBuffer::bind() const {
+
+        if(RendererAPI::bindVertexBuffer(m_RendererID))
+            ++RendererAPI::getRecording().bufferBinds;
+
+    }
+
+    void StreamVertexBuffer::unbind() const {
+
+    }
+
+    void StreamVertexBuffer::setData(const void* data, uint32_t size) {
+
+        RendererAPI::getRecording().vertexBytes += size;
+
+    }
+
+    uint32_t StreamVertexBuffer::commit(uint32_t size) {
+
+        GEOGL_CORE_ASSERT(size <= m_RegionSize, "Tried to commit {} bytes to a stream buffer region of {} bytes.", size, m_RegionSize);
+        RendererAPI::getRecording().vertexBytes += size;
+        return 0;
+
+    }
+
+
+    /*
+     *  Index Buffer
+     */
+    IndexBuffer::IndexBuffer(uint32_t* indices, uint32_t count) : m_RendererID(RendererAPI::generateRendererID()), m_Count(count){
+
+        RendererAPI::getRecording().indexBytes += (uint64_t) count * sizeof(uint32_t);
+
+    }
+
+    void IndexBuffer::bind() const {
+
+        /* The element array buffer belongs to the bound vertex array, so OpenGL makes every one of these binds */
+        ++RendererAPI::getRecording().bufferBinds;
+
+    }
+
+    UniformBuffer::UniformBuffer(uint32_t size, uint32_t binding) : m_RendererID(RendererAPI::generateRendererID()), m_Size(size), m_Binding(binding){
+
+    }
+
+    void UniformBuffer::setData(const void* data, uint32_t size, uint32_t offset) {
+
+        GEOGL_CORE_ASSERT(offset + size <= m_Size, "Tried to write {} bytes at {} to a uniform buffer of {} bytes.", size, offset, m_Size);
+        RendererAPI::getRecording().uniformBytes += size;
+
+    }
+
+    void UniformBuffer::bind() const {
+
+        if(RendererAPI::bindUniformBuffer(m_Binding, m_RendererID, 0, UINT32_MAX))
+            ++RendererAPI::getRecording().bufferBinds;
+
+    }
+
+    void UniformBuffer::bindRange(uint32_t offset, uint32_t size) const {
+
+        if(RendererAPI::bindUniformBuffer(m_Binding, m_RendererID, offset, size))
+            ++RendererAPI::getRecording().bufferBinds;
+
+    }
+
+}
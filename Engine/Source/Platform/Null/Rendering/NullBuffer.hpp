@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLBUFFER_HPP
+#define GEOGL_NULLBUFFER_HPP
+
+#include "../../../GEOGL/Rendering/Buffer.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    class GEOGL_API VertexBuffer : public GEOGL::VertexBuffer{
+    public:
+        VertexBuffer(uint32_t size);
+        VertexBuffer(float* vertices, uint32_t size);
+        virtual ~VertexBuffer() = default;
+
+        virtual void bind() const override;
+        virtual void unbind() const override;
+        virtual void setData(const void* data, uint32_t size) override;
+
+        inline void setLayout(const BufferLayout& layout) override { m_Layout = layout; };
+        inline const BufferLayout& getLayout() const override { return m_Layout; };
+
+        inline uint32_t getRendererID() const override { return m_RendererID; };
+
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_Size;
+        BufferLayout m_Layout;
+    };
+
+
+    /**
+     * \brief A StreamVertexBuffer with a single region in CPU memory. Every commit is recorded as an upload.
+     */
+    class GEOGL_API StreamVertexBuffer : public GEOGL::StreamVertexBuffer{
+    public:
+        StreamVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+        virtual ~StreamVertexBuffer() = default;
+
+        virtual void bind() const override;
+        virtual void unbind() const override;
+        virtual void setData(const void* data, uint32_t size) override;
+
+        inline void setLayout(const BufferLayout& layout) override { m_Layout = layout; };
+        inline const BufferLayout& getLayout() const override { return m_Layout; };
+
+        inline void* getWritePointer() override { return m_StagingBuffer.get(); };
+        inline uint32_t getRegionSize() const override { return m_RegionSize; };
+        virtual uint32_t commit(uint32_t size) override;
+        inline void advance() override {};
+        inline void endFrame() override {};
+
+        inline uint32_t getRendererID() const override { return m_RendererID; };
+
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_RegionSize;
+        BufferLayout m_Layout;
+
+        std::unique_ptr<uint8_t[]> m_StagingBuffer;
+    };
+
+
+    class GEOGL_API IndexBuffer : public GEOGL::IndexBuffer{
+    public:
+        IndexBuffer(uint32_t* indices, uint32_t count);
+        virtual ~IndexBuffer() = default;
+
+        virtual void bind() const override;
+        virtual void unbind() const override {};
+
+        virtual inline uint32_t getCount() const override {return m_Count; };
+
+        inline uint32_t getRendererID() const override { return m_RendererID; };
+
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_Count;
+
+    };
+
+    class GEOGL_API UniformBuffer : public GEOGL::UniformBuffer{
+    public:
+        UniformBuffer(uint32_t size, uint32_t binding);
+        virtual ~UniformBuffer() = default;
+
+        virtual void setData(const void* data, uint32_t size, uint32_t offset) override;
+        inline void invalidate() override {};
+
+        virtual void bind() const override;
+        virtual void bindRange(uint32_t offset, uint32_t size) const override;
+
+        inline uint32_t getSize() const override { return m_Size; };
+        inline uint32_t getBinding() const override { return m_Binding; };
+
+    private:
+        uint32_t m_RendererID;
+        uint32_t m_Size;
+        uint32_t m_Binding;
+
+    };
+
+}
+
+#endif //GEOGL_NULLBUFFER_HPP
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "NullFramebuffer.hpp"
+#include "NullRendererAPI.hpp"
+
+namespace GEOGL::Platform::Null{
+
+
+    Framebuffer::Framebuffer(const FramebufferSpecification &framebufferSpecification)
+        : m_FramebufferSpecification(framebufferSpecification) {
+
+        invalidate();
+
+    }
+
+    void Framebuffer::bind() const {
+
+        /* Binding a framebuffer also sets the viewport to it */
+        Recording& recording = RendererAPI::getRecording();
+        if(RendererAPI::bindFramebuffer(m_RendererID))
+            ++recording.framebufferBinds;
+        if(RendererAPI::applyViewport({m_FramebufferSpecification.width, m_FramebufferSpecification.height}))
+            ++recording.viewportChanges;
+
+    }
+
+    void Framebuffer::unbind() const {
+
+        if(RendererAPI::bindFramebuffer(0))
+            ++RendererAPI::getRecording().framebufferBinds;
+
+    }
+
+    void Framebuffer::invalidate() {
+
+        /* OpenGL recreates the framebuffer, so it has to be bound again */
+        m_RendererID = RendererAPI::generateRendererID();
+
+        m_ColorAttachment = GEOGL::Texture2D::create(m_FramebufferSpecification.width, m_FramebufferSpecification.height);
+
+    }
+
+    void Framebuffer::resize(uint32_t width, uint32_t height){
+
+        m_FramebufferSpecification.width = width;
+        m_FramebufferSpecification.height = height;
+        invalidate();
+
+    }
+
+}
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLFRAMEBUFFER_HPP
+#define GEOGL_NULLFRAMEBUFFER_HPP
+
+#include "../../../GEOGL/Rendering/Framebuffer.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    class GEOGL_API Framebuffer : public GEOGL::Framebuffer{
+    public:
+        Framebuffer(const FramebufferSpecification& framebufferSpecification);
+        virtual ~Framebuffer() override = default;
+
+        void invalidate();
+
+        void bind() const override;
+        void unbind() const override;
+
+        void resize(uint32_t width, uint32_t height) override;
+
+        [[nodiscard]] inline uint32_t getColorAttachmentRendererID() const override {return m_ColorAttachment->getRendererID(); };
+        [[nodiscard]] inline const Ref<GEOGL::Texture2D>& getColorAttachment() const override { return m_ColorAttachment; };
+
+        [[nodiscard]] inline const FramebufferSpecification& getFramebufferSpecification() const override { return m_FramebufferSpecification; };
+
+    private:
+        uint32_t m_RendererID = 0;
+        Ref<GEOGL::Texture2D> m_ColorAttachment;
+        FramebufferSpecification m_FramebufferSpecification;
+
+    };
+
+}
+
+#endif //GEOGL_NULLFRAMEBUFFER_HPP
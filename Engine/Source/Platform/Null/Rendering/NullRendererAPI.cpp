@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include "NullRendererAPI.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    static Recording s_Recording;
+    static uint32_t s_NextRendererID = 1;
+
+    struct UniformBufferBinding{
+        uint32_t rendererID = 0;
+        uint32_t offset = 0;
+        uint32_t size = 0;
+
+        bool operator==(const UniformBufferBinding& other) const { return rendererID == other.rendererID && offset == other.offset && size == other.size; };
+    };
+
+    /* Renderer IDs start at 1, so 0 means nothing is bound */
+    static uint32_t s_BoundVertexBuffer = 0;
+    static std::vector<UniformBufferBinding> s_BoundUniformBuffers;
+    static std::vector<uint32_t> s_BoundTextureUnits;
+    static uint32_t s_BoundFramebuffer = 0;
+    static glm::ivec2 s_Viewport{-1};
+
+    template<typename T>
+    static bool change(T& current, const T& value){
+
+        if(current == value)
+            return false;
+
+        current = value;
+        return true;
+
+    }
+
+    static void recordDrawTexture(){
+
+        s_Recording.drawTextures.push_back(s_BoundTextureUnits.empty() ? 0 : s_BoundTextureUnits[0]);
+
+    }
+
+    /* Since this is the Null Rendering api, we know the api is Null */
+    RendererAPI::RendererAPI() : GEOGL::RendererAPI(RENDERING_NULL){
+
+    }
+
+    RendererAPI::~RendererAPI() {
+
+    }
+
+    void RendererAPI::init(){
+        GEOGL_PROFILE_FUNCTION();
+
+        GEOGL_CORE_INFO_NOSTRIP("Initializing the Null RendererAPI. Nothing will be drawn.");
+
+        /* There is no GPU to query, so report the limits of OpenGL 3.3, which every other backend exceeds */
+        m_Capabilities = RenderCaps();
+
+        s_BoundVertexBuffer = 0;
+        s_BoundUniformBuffers.clear();
+        s_BoundTextureUnits.clear();
+        s_BoundFramebuffer = 0;
+        s_Viewport = glm::ivec2(-1);
+        resetRecording();
+
+    }
+
+    void RendererAPI::shutdown(){
+
+        GEOGL_CORE_INFO_NOSTRIP("Shutting down GEOGL Null Renderer.");
+
+    }
+
+    void RendererAPI::setViewport(const glm::ivec2 &dimensions) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        m_Viewport = dimensions;
+        if(applyViewport(dimensions))
+            ++s_Recording.viewportChanges;
+
+    }
+
+    void RendererAPI::setClearColor(const glm::vec4 &color) {
+        m_ClearColor = color;
+    }
+
+    void RendererAPI::clear() {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        ++s_Recording.clears;
+
+    }
+
+    void RendererAPI::drawIndexed(const Ref<GEOGL::VertexArray> &vertexArray, uint32_t indexCount, uint32_t baseVertex) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        uint32_t count = indexCount ? indexCount : vertexArray->getIndexBuffer()->getCount();
+
+        ++s_Recording.drawCalls;
+        s_Recording.indexCount += count;
+        recordDrawTexture();
+
+    }
+
+    void RendererAPI::drawIndexedInstanced(const Ref<GEOGL::VertexArray> &vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        uint32_t count = indexCount ? indexCount : vertexArray->getIndexBuffer()->getCount();
+
+        ++s_Recording.drawCalls;
+        ++s_Recording.instancedDrawCalls;
+        s_Recording.indexCount += (uint64_t) count * instanceCount;
+        s_Recording.instanceCount += instanceCount;
+        recordDrawTexture();
+
+    }
+
+    Recording& RendererAPI::getRecording() {
+        return s_Recording;
+    }
+
+    void RendererAPI::resetRecording() {
+        s_Recording = Recording();
+    }
+
+    uint32_t RendererAPI::generateRendererID() {
+        return s_NextRendererID++;
+    }
+
+    bool RendererAPI::bindVertexBuffer(uint32_t rendererID) {
+        return change(s_BoundVertexBuffer, rendererID);
+    }
+
+    bool RendererAPI::bindUniformBuffer(uint32_t binding, uint32_t rendererID, uint32_t offset, uint32_t size) {
+
+        if(binding >= s_BoundUniformBuffers.size())
+            s_BoundUniformBuffers.resize(binding + 1);
+        return change(s_BoundUniformBuffers[binding], {rendererID, offset, size});
+
+    }
+
+    bool RendererAPI::bindTextureUnit(uint32_t unit, uint32_t rendererID) {
+
+        if(unit >= s_BoundTextureUnits.size())
+            s_BoundTextureUnits.resize(unit + 1, 0);
+        return change(s_BoundTextureUnits[unit], rendererID);
+
+    }
+
+    bool RendererAPI::bindFramebuffer(uint32_t rendererID) {
+        return change(s_BoundFramebuffer, rendererID);
+    }
+
+    bool RendererAPI::applyViewport(const glm::ivec2& dimensions) {
+        return change(s_Viewport, dimensions);
+    }
+
+}
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLRENDERERAPI_HPP
+#define GEOGL_NULLRENDERERAPI_HPP
+
+
+#include "../../../GEOGL/Rendering/RendererAPI.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    /**
+     * \brief Everything the Null backend was asked to do since the recording was last reset.
+     */
+    struct GEOGL_API Recording{
+        /* Draws */
+        uint64_t drawCalls = 0;
+        uint64_t instancedDrawCalls = 0;
+        uint64_t indexCount = 0;
+        uint64_t instanceCount = 0;
+        uint64_t clears = 0;
+
+        /* The texture bound to unit 0 by every draw, in the order they were drawn */
+        std::vector<uint32_t> drawTextures;
+
+        /* Bytes that would have been uploaded to the GPU */
+        uint64_t vertexBytes = 0;
+        uint64_t indexBytes = 0;
+        uint64_t textureBytes = 0;
+        uint64_t uniformBytes = 0;
+
+        /* State changes, leaving out those to state that was already set, as the OpenGL StateCache does */
+        uint64_t shaderBinds = 0;
+        uint64_t vertexArrayBinds = 0;
+        uint64_t bufferBinds = 0;
+        uint64_t textureBinds = 0;
+        uint64_t framebufferBinds = 0;
+        uint64_t viewportChanges = 0;
+        uint64_t uniformUploads = 0;
+
+        [[nodiscard]] inline uint64_t getUploadedBytes() const { return vertexBytes + indexBytes + textureBytes + uniformBytes; };
+        [[nodiscard]] inline uint64_t getStateChanges() const {
+            return shaderBinds + vertexArrayBinds + bufferBinds + textureBinds + framebufferBinds + viewportChanges + uniformUploads;
+        };
+    };
+
+    /**
+     * \brief Describes a RendererAPI that draws nothing, and only records what it was asked to do.
+     *
+     * Every Null object adds to the same Recording, so the throughput of the Renderer2D can be measured on machines
+     * without a display or a GPU.
+     */
+    class GEOGL_API RendererAPI : public GEOGL::RendererAPI{
+    public:
+        RendererAPI();
+        virtual ~RendererAPI();
+
+        void init() override;
+        void shutdown() override;
+        void setViewport(const glm::ivec2& dimensions) override;
+
+        void setClearColor(const glm::vec4& color) override;
+        void clear() override;
+
+        virtual void drawIndexed(const Ref<GEOGL::VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+        virtual void drawIndexedInstanced(const Ref<GEOGL::VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
+        virtual void renderWireframe(bool* status) override {};
+
+        /**
+         * \brief Gets what every Null object was asked to do since the last resetRecording.
+         */
+        static Recording& getRecording();
+        static void resetRecording();
+
+        /**
+         * \brief Gets a renderer ID no other Null object has, starting at 1 so 0 still means nothing is bound.
+         */
+        static uint32_t generateRendererID();
+
+        /**
+         * \brief Makes an object the one bound to a binding point, as the OpenGL StateCache tracks them. A whole
+         * uniform buffer is bound with a size of UINT32_MAX.
+         * @return Whether the binding changed, and OpenGL would have made the bind.
+         */
+        static bool bindVertexBuffer(uint32_t rendererID);
+        static bool bindUniformBuffer(uint32_t binding, uint32_t rendererID, uint32_t offset, uint32_t size);
+        static bool bindTextureUnit(uint32_t unit, uint32_t rendererID);
+        static bool bindFramebuffer(uint32_t rendererID);
+        static bool applyViewport(const glm::ivec2& dimensions);
+
+    };
+
+
+}
+
+
+#endif //GEOGL_NULLRENDERERAPI_HPP
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "NullShader.hpp"
+#include "NullRendererAPI.hpp"
+
+#include <utility>
+
+namespace GEOGL::Platform::Null{
+
+    Shader::Shader(const std::string &vertexSrc, const std::string &fragmentSrc, std::string name)
+        : m_RendererID(RendererAPI::generateRendererID()), m_Name(std::move(name)){
+
+    }
+
+    Shader::Shader(const std::string& folderPath, const ShaderDefines& defines) : m_RendererID(RendererAPI::generateRendererID()){
+        GEOGL_PROFILE_FUNCTION();
+
+        /* Still read and preprocess the source, so a missing shader or include fails the same way it would on a GPU */
+        GEOGL_CORE_INFO("Loading shader {}/shader.glsl", folderPath);
+        loadSource(folderPath, defines);
+
+        /* Get the name from the folder path */
+        auto lastSlash = folderPath.find_last_of("/\\");
+        lastSlash = lastSlash == std::string::npos ? 0 : lastSlash +1;
+
+        m_Name = folderPath.substr(lastSlash);
+
+    }
+
+    Shader::Shader(const std::string& source, std::string name)
+        : m_RendererID(RendererAPI::generateRendererID()), m_Name(std::move(name)){
+
+    }
+
+    Shader::~Shader(){
+
+        if(m_RendererID == getBoundID())
+            setBoundID(0);
+
+    }
+
+    void Shader::bind() const {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        if(m_RendererID != getBoundID()) {
+            ++RendererAPI::getRecording().shaderBinds;
+            setBoundID(m_RendererID);
+        }
+
+    }
+
+    void Shader::unbind() const {
+
+        setBoundID(0);
+
+    }
+
+    void Shader::setInt(UniformID uniform, int value){
+
+        recordUniform(sizeof(int));
+
+    }
+
+    void Shader::setIntArray(UniformID uniform, int* values, uint32_t count){
+
+        recordUniform(sizeof(int) * count);
+
+    }
+
+    void Shader::setFloat(UniformID uniform, float value) {
+
+        recordUniform(sizeof(float));
+
+    }
+
+    void Shader::setFloat2(UniformID uniform, const glm::vec2 &value) {
+
+        recordUniform(sizeof(glm::vec2));
+
+    }
+
+    void Shader::setFloat3(UniformID uniform, const glm::vec3 &value) {
+
+        recordUniform(sizeof(glm::vec3));
+
+    }
+
+    void Shader::setFloat4(UniformID uniform, const glm::vec4 &value) {
+
+        recordUniform(sizeof(glm::vec4));
+
+    }
+
+    void Shader::setMat4(UniformID uniform, const glm::mat4 &value) {
+
+        recordUniform(sizeof(glm::mat4));
+
+    }
+
+    void Shader::recordUniform(uint32_t size) {
+
+        Recording& recording = RendererAPI::getRecording();
+        ++recording.uniformUploads;
+        recording.uniformBytes += size;
+
+    }
+
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLSHADER_HPP
+#define GEOGL_NULLSHADER_HPP
+
+#include "../../../GEOGL/Rendering/Shader.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    /**
+     * \brief A Shader that compiles nothing. Uniforms are recorded by their size.
+     */
+    class GEOGL_API Shader : public GEOGL::Shader{
+    public:
+        Shader(const std::string& vertexSrc, const std::string& fragmentSrc, std::string name);
+        Shader(const std::string& folderPath, const ShaderDefines& defines = {});
+        Shader(const std::string& source, std::string name);
+        ~Shader() override;
+
+        void bind() const override;
+        void unbind() const override;
+
+        void setInt(UniformID uniform, int value) override;
+        void setIntArray(UniformID uniform, int* values, uint32_t count) override;
+        void setFloat(UniformID uniform, float value) override;
+        void setFloat2(UniformID uniform, const glm::vec2& value) override;
+        void setFloat3(UniformID uniform, const glm::vec3& value) override;
+        void setFloat4(UniformID uniform, const glm::vec4& value) override;
+        void setMat4(UniformID uniform, const glm::mat4& value) override;
+
+        const std::string & getName() const override {return m_Name;};
+
+    private:
+        void recordUniform(uint32_t size);
+
+    private:
+        uint32_t m_RendererID;
+        std::string m_Name;
+    };
+
+}
+
+#endif //GEOGL_NULLSHADER_HPP
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "NullTexture.hpp"
+#include "NullRendererAPI.hpp"
+#include <STB/stb_image.h>
+#include <utility>
+
+namespace GEOGL::Platform::Null {
+
+    Texture2D::Texture2D(uint32_t width, uint32_t height) :
+        m_Path("No Path, Loaded by Data"), m_Width(width), m_Height(height), m_Channels(4), m_RendererID(RendererAPI::generateRendererID()){
+
+    }
+
+    Texture2D::Texture2D(std::string filePath)
+    : m_Path(std::move(filePath)), m_RendererID(RendererAPI::generateRendererID()){
+        GEOGL_PROFILE_FUNCTION();
+
+        int width = 1, height = 1, channels = 4;
+        bool found = stbi_info(m_Path.c_str(), &width, &height, &channels);
+        GEOGL_CORE_ASSERT_NOSTRIP(found, "Failed to load image {}", m_Path);
+
+        m_Width = width;
+        m_Height = height;
+        m_Channels = channels;
+
+        RendererAPI::getRecording().textureBytes += (uint64_t) m_Width * m_Height * m_Channels;
+
+    }
+
+    void Texture2D::setData(void *data, uint32_t size) {
+
+        GEOGL_CORE_ASSERT(size == m_Width * m_Height * m_Channels, "The size of the data must be the entire texture.");
+        RendererAPI::getRecording().textureBytes += size;
+        markContentChanged();
+
+    }
+
+    void Texture2D::setSubData(void *data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+
+        GEOGL_CORE_ASSERT(x + width <= m_Width && y + height <= m_Height, "The region must be inside of the texture.");
+        RendererAPI::getRecording().textureBytes += (uint64_t) width * height * m_Channels;
+        markContentChanged();
+
+    }
+
+    void Texture2D::bind(uint32_t slotID) const {
+
+        if(RendererAPI::bindTextureUnit(slotID, m_RendererID))
+            ++RendererAPI::getRecording().textureBinds;
+
+    }
+
+}
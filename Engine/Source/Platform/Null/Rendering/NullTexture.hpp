@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLTEXTURE_HPP
+#define GEOGL_NULLTEXTURE_HPP
+
+#include "../../../GEOGL/Rendering/Texture.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    /**
+     * \brief A Texture2D that stores no texels. Loading from a file only reads the image header.
+     */
+    class GEOGL_API Texture2D : public GEOGL::Texture2D{
+    public:
+        Texture2D(uint32_t width, uint32_t height);
+        explicit Texture2D(std::string filePath);
+        ~Texture2D() = default;
+
+        [[nodiscard]] inline uint32_t getWidth() const override { return m_Width; };
+        [[nodiscard]] inline uint32_t getHeight() const override { return m_Height; };
+        [[nodiscard]] inline uint32_t getRendererID() const override { return m_RendererID; };
+
+        void setData(void* data, uint32_t size) override;
+        void setSubData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+        void bind(uint32_t slotID) const override;
+
+        bool operator==(const GEOGL::Texture2D& other) const override{
+            return m_RendererID == other.getRendererID();
+        };
+
+    private:
+        std::string m_Path;
+        uint32_t m_Width, m_Height;
+        uint32_t m_Channels;
+        uint32_t m_RendererID;
+    };
+
+}
+
+#endif //GEOGL_NULLTEXTURE_HPP
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "NullVertexArray.hpp"
+#include "NullRendererAPI.hpp"
+
+namespace GEOGL::Platform::Null{
+
+
+    VertexArray::VertexArray() : m_RendererID(RendererAPI::generateRendererID()){
+
+    }
+
+    VertexArray::~VertexArray(){
+
+        if(m_RendererID == getBoundID())
+            setBoundID(0);
+
+    }
+
+    void VertexArray::bind() const{
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        /* Only record the binds OpenGL would have made */
+        if(m_RendererID != getBoundID()) {
+            ++RendererAPI::getRecording().vertexArrayBinds;
+            setBoundID(m_RendererID);
+        }
+
+    }
+
+    void VertexArray::unbind() const{
+
+        setBoundID(0);
+
+    }
+
+    void VertexArray::addVertexBuffer(const Ref<GEOGL::VertexBuffer> &vertexBuffer){
+
+        GEOGL_CORE_ASSERT_NOSTRIP(!vertexBuffer->getLayout().getElements().empty(),
+                                  "Null Vertex Buffer elements appears to be empty. Please call setLayout() with a valid BufferLayout on your VertexBuffer before calling {}().", __func__);
+
+        m_VertexBuffers.push_back(vertexBuffer);
+
+    }
+
+    void VertexArray::setVertexBuffer(uint32_t binding, const Ref<GEOGL::VertexBuffer> &vertexBuffer, uint32_t offset){
+
+        GEOGL_CORE_ASSERT(binding < m_VertexBuffers.size(), "Vertex array has no binding {}.", binding);
+        GEOGL_CORE_ASSERT(vertexBuffer->getLayout().getStride() == m_VertexBuffers[binding]->getLayout().getStride(),
+                          "Vertex buffer stride does not match binding {}.", binding);
+
+        m_VertexBuffers[binding] = vertexBuffer;
+
+    }
+
+    void VertexArray::setIndexBuffer(const Ref<GEOGL::IndexBuffer> &indexBuffer){
+
+        m_IndexBuffer = indexBuffer;
+
+    }
+
+}
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLVERTEXARRAY_HPP
+#define GEOGL_NULLVERTEXARRAY_HPP
+
+#include "../../../GEOGL/Rendering/VertexArray.hpp"
+
+namespace GEOGL::Platform::Null{
+
+    class GEOGL_API VertexArray : public GEOGL::VertexArray{
+    public:
+        VertexArray();
+        virtual ~VertexArray();
+
+        void bind() const override;
+        void unbind() const override;
+
+        void addVertexBuffer(const Ref<GEOGL::VertexBuffer>& vertexBuffer) override;
+        void setVertexBuffer(uint32_t binding, const Ref<GEOGL::VertexBuffer>& vertexBuffer, uint32_t offset) override;
+        void setIndexBuffer(const Ref<GEOGL::IndexBuffer>& indexBuffer) override;
+
+        inline const std::vector<Ref<GEOGL::VertexBuffer>>& getVertexBuffers() const override{ return m_VertexBuffers; };
+        inline const Ref<GEOGL::IndexBuffer>& getIndexBuffer() const override{ return m_IndexBuffer; } ;
+
+    private:
+        uint32_t m_RendererID;
+        std::vector<Ref<GEOGL::VertexBuffer>> m_VertexBuffers;
+        Ref<GEOGL::IndexBuffer> m_IndexBuffer;
+
+    };
+
+}
+
+#endif //GEOGL_NULLVERTEXARRAY_HPP
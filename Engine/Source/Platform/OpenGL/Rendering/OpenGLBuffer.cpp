@@ -24,6 +24,8 @@
 
 #include <glad/glad.h>
 #include "OpenGLBuffer.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
 
 
 namespace GEOGL::Platform::OpenGL{
@@ -40,22 +42,17 @@ namespace GEOGL::Platform::OpenGL{
         m_Size = size;
 
         /* Now, upload to the GPU */
-        {
-            GEOGL_PROFILE_SCOPE("Create Buffer");
-            glCreateBuffers(1, &m_VBOID);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Bind Buffer");
-            glBindBuffer(GL_ARRAY_BUFFER, m_VBOID);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Upload Buffer");
-            glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
-        }
-
-
+        RenderThread::execute([&](){
+            {
+                GEOGL_PROFILE_SCOPE("Create Buffer");
+                glCreateBuffers(1, &m_VBOID);
+            }
+
+            {
+                GEOGL_PROFILE_SCOPE("Upload Buffer");
+                glNamedBufferData(m_VBOID, size, nullptr, GL_DYNAMIC_DRAW);
+            }
+        });
 
     }
 
@@ -66,55 +63,222 @@ namespace GEOGL::Platform::OpenGL{
         void* vector = (void*)vertices;
 
         /* Now, upload to the GPU */
-        {
-            GEOGL_PROFILE_SCOPE("Create Buffer");
-            glCreateBuffers(1, &m_VBOID);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Bind Buffer");
-            glBindBuffer(GL_ARRAY_BUFFER, m_VBOID);
-        }
+        RenderThread::execute([&](){
+            {
+                GEOGL_PROFILE_SCOPE("Create Buffer");
+                glCreateBuffers(1, &m_VBOID);
+            }
+
+            {
+                GEOGL_PROFILE_SCOPE("Upload Buffer");
+                glNamedBufferData(m_VBOID, m_Size, vector, GL_STATIC_DRAW);
+            }
+        });
 
         GEOGL_CORE_CRITICAL_NOSTRIP("Creating the vertex buffer #{}", m_VBOID);
 
-        {
-            GEOGL_PROFILE_SCOPE("Upload Buffer");
-            glBufferData(GL_ARRAY_BUFFER, m_Size, vector, GL_STATIC_DRAW);
-        }
-
-
     }
 
 
     VertexBuffer::~VertexBuffer() {
         GEOGL_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glDeleteBuffers(1, &m_VBOID);
+        RenderThread::submit([vboID = m_VBOID](){
+            StateCache::deleteBuffer(vboID);
+        });
 
     }
 
     void VertexBuffer::bind() const {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBOID);
+        RenderThread::submit([vboID = m_VBOID](){
+            StateCache::bindBuffer(GL_ARRAY_BUFFER, vboID);
+        });
 
     }
 
     void VertexBuffer::unbind() const {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        RenderThread::submit([](){
+            StateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+        });
 
     }
 
     void VertexBuffer::setData(const void* data, uint32_t size) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBOID);
+        const void* stagedData = RenderThread::stage(data, size);
+        /* Written through its name, so uploading never disturbs the bindings */
+        RenderThread::submit([vboID = m_VBOID, stagedData, size](){
+            glNamedBufferSubData(vboID, 0, size, stagedData);
+        });
+
+    }
+
+
+    /*
+     * Stream Vertex Buffer
+     */
+
+    StreamVertexBuffer::StreamVertexBuffer(uint32_t regionSize, uint32_t regionCount) : m_RegionSize(regionSize){
+        GEOGL_PROFILE_FUNCTION();
+
+        RenderThread::execute([&](){
+            glCreateBuffers(1, &m_VBOID);
+
+            /* The render thread copies each batch into its command list, so the vertices have to be staged anyway */
+            if(GLAD_GL_VERSION_4_4 && !RenderThread::isEnabled()){
+                m_RegionCount = regionCount;
+
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                GLsizeiptr size = (GLsizeiptr)m_RegionSize * m_RegionCount;
+                glNamedBufferStorage(m_VBOID, size, nullptr, flags);
+                m_MappedBuffer = (uint8_t*)glMapNamedBufferRange(m_VBOID, 0, size, flags);
+            }
+
+            /* Fall back to orphaning a single region if the buffer could not be mapped */
+            if(!m_MappedBuffer){
+                if(!RenderThread::isEnabled())
+                    GEOGL_CORE_WARN("Persistently mapped buffers are unavailable, streaming vertices by orphaning instead.");
+                m_RegionCount = 1;
+                m_StagingBuffer = std::make_unique<uint8_t[]>(m_RegionSize);
+                glNamedBufferData(m_VBOID, m_RegionSize, nullptr, GL_STREAM_DRAW);
+            }
+        });
+
+    }
+
+    StreamVertexBuffer::~StreamVertexBuffer() {
+        GEOGL_PROFILE_FUNCTION();
+
+        RenderThread::submit([vboID = m_VBOID, mapped = m_MappedBuffer != nullptr, fences = std::move(m_FrameFences)](){
+            for(auto& frameFence : fences){
+                glDeleteSync((GLsync)frameFence.fence);
+            }
+
+            if(mapped)
+                glUnmapNamedBuffer(vboID);
+
+            StateCache::deleteBuffer(vboID);
+        });
+
+    }
+
+    void StreamVertexBuffer::bind() const {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        RenderThread::submit([vboID = m_VBOID](){
+            StateCache::bindBuffer(GL_ARRAY_BUFFER, vboID);
+        });
+
+    }
+
+    void StreamVertexBuffer::unbind() const {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        RenderThread::submit([](){
+            StateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+        });
+
+    }
+
+    void StreamVertexBuffer::setData(const void* data, uint32_t size) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        GEOGL_CORE_ASSERT(size <= m_RegionSize * m_RegionCount, "Tried to write {} bytes to a stream buffer of {} bytes.", size, m_RegionSize * m_RegionCount);
+
+        if(m_MappedBuffer){
+            /* Every region may be rewritten, so wait for all of them, the ones of this frame included */
+            endFrame();
+            waitForRegion(m_NextRegion + m_RegionCount - 1);
+            memcpy(m_MappedBuffer, data, size);
+        }else{
+            const void* stagedData = RenderThread::stage(data, size);
+            RenderThread::submit([vboID = m_VBOID, stagedData, size](){
+                glNamedBufferSubData(vboID, 0, size, stagedData);
+            });
+        }
+
+    }
+
+    void* StreamVertexBuffer::getWritePointer() {
+
+        return m_MappedBuffer ? m_MappedBuffer + getRegionOffset() : m_StagingBuffer.get();
+
+    }
+
+    uint32_t StreamVertexBuffer::commit(uint32_t size) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        GEOGL_CORE_ASSERT(size <= m_RegionSize, "Tried to commit {} bytes to a stream buffer region of {} bytes.", size, m_RegionSize);
 
-        glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+        /* The mapping is coherent, so the writes are already visible to the GPU */
+        if(m_MappedBuffer)
+            return getRegionOffset();
+
+        /* Orphan the old storage so the driver does not have to wait for draws still reading it */
+        const void* stagedData = RenderThread::stage(m_StagingBuffer.get(), size);
+        RenderThread::submit([vboID = m_VBOID, regionSize = m_RegionSize, stagedData, size](){
+            glNamedBufferData(vboID, regionSize, nullptr, GL_STREAM_DRAW);
+            glNamedBufferSubData(vboID, 0, size, stagedData);
+        });
+        return 0;
+
+    }
+
+    void StreamVertexBuffer::advance() {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        if(!m_MappedBuffer)
+            return;
+
+        /* The batch in the current region is fenced with the rest of its frame, in endFrame */
+        ++m_NextRegion;
+        waitForRegion(m_NextRegion);
+
+    }
+
+    void StreamVertexBuffer::endFrame() {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        if(!m_MappedBuffer || m_FrameFirstRegion == m_NextRegion)
+            return;
+
+        m_FrameFences.push_back({glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), m_FrameFirstRegion});
+        m_FrameFirstRegion = m_NextRegion;
+
+    }
+
+    void StreamVertexBuffer::waitForRegion(uint64_t region) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        /* Nothing has been written to the region yet */
+        if(region < m_RegionCount)
+            return;
+
+        /* A frame that draws more batches than the ring has regions wraps onto itself, so it has to be fenced early */
+        uint64_t previousUse = region - m_RegionCount;
+        if(previousUse >= m_FrameFirstRegion)
+            endFrame();
+
+        while(!m_FrameFences.empty() && m_FrameFences.front().firstRegion <= previousUse){
+            auto fence = (GLsync)m_FrameFences.front().fence;
+
+            /* Only flush on the first attempt, after that the fence is guaranteed to be submitted */
+            GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while(true){
+                GLenum result = glClientWaitSync(fence, waitFlags, 1000000);
+                if(result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+                    break;
+                waitFlags = 0;
+            }
+
+            glDeleteSync(fence);
+            m_FrameFences.erase(m_FrameFences.begin());
+        }
 
     }
 
@@ -130,43 +294,108 @@ namespace GEOGL::Platform::OpenGL{
 
         GLsizeiptr vectorSizeBytes = count * sizeof(uint32_t); // Times size of glm::vec3 component vector.
 
-        {
-            GEOGL_PROFILE_SCOPE("Create Buffer");
-            glCreateBuffers(1, &m_IndexBufferID);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Bind Buffer");
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBufferID);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Upload Buffer");
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, vectorSizeBytes, (void*)indices, GL_STATIC_DRAW);
-        }
+        RenderThread::execute([&](){
+            {
+                GEOGL_PROFILE_SCOPE("Create Buffer");
+                glCreateBuffers(1, &m_IndexBufferID);
+            }
 
+            /* Binding it would attach it to whichever vertex array is bound, so it is uploaded through its name */
+            {
+                GEOGL_PROFILE_SCOPE("Upload Buffer");
+                glNamedBufferData(m_IndexBufferID, vectorSizeBytes, (void*)indices, GL_STATIC_DRAW);
+            }
+        });
 
     }
 
     IndexBuffer::~IndexBuffer() {
         GEOGL_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-        glDeleteBuffers(1, &m_IndexBufferID);
+        RenderThread::submit([indexBufferID = m_IndexBufferID](){
+            StateCache::deleteBuffer(indexBufferID);
+        });
 
     }
 
     void IndexBuffer::bind() const {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBufferID);
+        RenderThread::submit([indexBufferID = m_IndexBufferID](){
+            StateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID);
+        });
 
     }
 
     void IndexBuffer::unbind() const {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        RenderThread::submit([](){
+            StateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        });
+
+    }
+
+    /*
+     * Uniform Buffer
+     */
+
+    UniformBuffer::UniformBuffer(uint32_t size, uint32_t binding) : m_Size(size), m_Binding(binding) {
+        GEOGL_PROFILE_FUNCTION();
+
+        RenderThread::execute([&](){
+            glCreateBuffers(1, &m_UBOID);
+            glNamedBufferData(m_UBOID, size, nullptr, GL_DYNAMIC_DRAW);
+        });
+
+    }
+
+    UniformBuffer::~UniformBuffer() {
+        GEOGL_PROFILE_FUNCTION();
+
+        RenderThread::submit([uboID = m_UBOID](){
+            StateCache::deleteBuffer(uboID);
+        });
+
+    }
+
+    void UniformBuffer::setData(const void* data, uint32_t size, uint32_t offset) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        GEOGL_CORE_ASSERT(offset + size <= m_Size, "Tried to write {} bytes at {} to a uniform buffer of {} bytes.", size, offset, m_Size);
+
+        const void* stagedData = RenderThread::stage(data, size);
+        RenderThread::submit([uboID = m_UBOID, stagedData, size, offset](){
+            glNamedBufferSubData(uboID, offset, size, stagedData);
+        });
+
+    }
+
+    void UniformBuffer::invalidate() {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        /* Orphan the old storage, which the driver frees once the draws reading it are done */
+        RenderThread::submit([uboID = m_UBOID, size = m_Size](){
+            glNamedBufferData(uboID, size, nullptr, GL_DYNAMIC_DRAW);
+        });
+
+    }
+
+    void UniformBuffer::bind() const {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        RenderThread::submit([uboID = m_UBOID, binding = m_Binding](){
+            StateCache::bindBufferBase(GL_UNIFORM_BUFFER, binding, uboID);
+        });
+
+    }
+
+    void UniformBuffer::bindRange(uint32_t offset, uint32_t size) const {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        RenderThread::submit([uboID = m_UBOID, binding = m_Binding, offset, size](){
+            StateCache::bindBufferRange(GL_UNIFORM_BUFFER, binding, uboID, offset, size);
+        });
 
     }
 }
@@ -42,6 +42,7 @@ namespace GEOGL::Platform::OpenGL{
         inline void setLayout(const BufferLayout& layout) override { m_Layout = layout; };
         inline const BufferLayout& getLayout() const override { return m_Layout; };
 
+        inline uint32_t getRendererID() const override { return m_VBOID; };
 
     private:
         uint32_t m_Size;
@@ -50,6 +51,67 @@ namespace GEOGL::Platform::OpenGL{
     };
 
 
+    /**
+     * \brief A StreamVertexBuffer backed by glBufferStorage, persistently and coherently mapped, with each region
+     * guarded by a fence.
+     *
+     * When buffer storage is unavailable (before OpenGL 4.4), batches are written to CPU memory instead and uploaded
+     * by orphaning the buffer on every commit.
+     */
+    class GEOGL_API StreamVertexBuffer : public GEOGL::StreamVertexBuffer{
+    public:
+        StreamVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+        virtual ~StreamVertexBuffer();
+
+        virtual void bind() const override;
+        virtual void unbind() const override;
+
+        /**
+         * \brief Waits for the GPU to finish with the buffer, then writes data to the start of it.
+         */
+        virtual void setData(const void* data, uint32_t size) override;
+
+        inline void setLayout(const BufferLayout& layout) override { m_Layout = layout; };
+        inline const BufferLayout& getLayout() const override { return m_Layout; };
+
+        virtual void* getWritePointer() override;
+        inline uint32_t getRegionSize() const override { return m_RegionSize; };
+        virtual uint32_t commit(uint32_t size) override;
+        virtual void advance() override;
+        virtual void endFrame() override;
+
+        inline bool isPersistentlyMapped() const { return m_MappedBuffer != nullptr; };
+
+        inline uint32_t getRendererID() const override { return m_VBOID; };
+
+    private:
+        void waitForRegion(uint64_t region);
+        inline uint32_t getRegionOffset() const { return (uint32_t)(m_NextRegion % m_RegionCount) * m_RegionSize; };
+
+    private:
+        /* Signalled once the GPU has drawn every region from firstRegion up to the next fence */
+        struct FrameFence{
+            void* fence;
+            uint64_t firstRegion;
+        };
+
+        uint32_t m_VBOID;
+        uint32_t m_RegionSize;
+        uint32_t m_RegionCount;
+        BufferLayout m_Layout;
+
+        /* Regions are counted from creation rather than wrapped, so the frame that last wrote one is easy to find */
+        uint64_t m_NextRegion = 0;
+        uint64_t m_FrameFirstRegion = 0;
+
+        uint8_t* m_MappedBuffer = nullptr;
+        std::vector<FrameFence> m_FrameFences;
+
+        /* Only used when the buffer can not be persistently mapped */
+        std::unique_ptr<uint8_t[]> m_StagingBuffer;
+    };
+
+
     class GEOGL_API IndexBuffer : public GEOGL::IndexBuffer{
     public:
         IndexBuffer(uint32_t* indices, uint32_t count);
@@ -60,12 +122,35 @@ namespace GEOGL::Platform::OpenGL{
 
         virtual inline uint32_t getCount() const override {return m_Count; };
 
+        inline uint32_t getRendererID() const override { return m_IndexBufferID; };
+
     private:
         uint32_t m_Count;
         uint32_t m_IndexBufferID;
 
     };
 
+    class GEOGL_API UniformBuffer : public GEOGL::UniformBuffer{
+    public:
+        UniformBuffer(uint32_t size, uint32_t binding);
+        virtual ~UniformBuffer();
+
+        virtual void setData(const void* data, uint32_t size, uint32_t offset) override;
+        virtual void invalidate() override;
+
+        virtual void bind() const override;
+        virtual void bindRange(uint32_t offset, uint32_t size) const override;
+
+        inline uint32_t getSize() const override { return m_Size; };
+        inline uint32_t getBinding() const override { return m_Binding; };
+
+    private:
+        uint32_t m_Size;
+        uint32_t m_Binding;
+        uint32_t m_UBOID;
+
+    };
+
 }
 
 #endif //GEOGL_OPENGLBUFFER_HPP
@@ -23,6 +23,8 @@
  *******************************************************************************/
 
 #include "OpenGLFramebuffer.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
 #include <glad/glad.h>
 
 namespace GEOGL::Platform::OpenGL{
@@ -37,59 +39,64 @@ namespace GEOGL::Platform::OpenGL{
 
     Framebuffer::~Framebuffer() {
 
-        glDeleteTextures(1, &m_ColorAttachment);
-        glDeleteTextures(1, &m_DepthAttachment);
-        glDeleteFramebuffers(1, &m_RendererID);
+        RenderThread::submit([rendererID = m_RendererID, depthAttachment = m_DepthAttachment](){
+            StateCache::deleteTexture(depthAttachment);
+            StateCache::deleteFramebuffer(rendererID);
+        });
 
     }
 
     void Framebuffer::bind() const {
 
-        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
-        glViewport(0,0, (GLsizei)m_FramebufferSpecification.width, (GLsizei)m_FramebufferSpecification.height);
+        RenderThread::submit([rendererID = m_RendererID, width = m_FramebufferSpecification.width, height = m_FramebufferSpecification.height](){
+            StateCache::bindFramebuffer(rendererID);
+            StateCache::viewport(0,0, (GLsizei)width, (GLsizei)height);
+        });
 
     }
 
     void Framebuffer::unbind() const {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        RenderThread::submit([](){
+            StateCache::bindFramebuffer(0);
+        });
     }
 
     void Framebuffer::invalidate() {
 
-        if(m_ColorAttachment){
-            glDeleteTextures(1, &m_ColorAttachment);
-            m_ColorAttachment = 0;
-        }
-        if(m_DepthAttachment){
-            glDeleteTextures(1, &m_DepthAttachment);
+        /* Frames still waiting to be rendered may use the old attachments, so they are deleted in order with them */
+        m_ColorAttachment = nullptr;
+        if(m_DepthAttachment || m_RendererID){
+            RenderThread::submit([rendererID = m_RendererID, depthAttachment = m_DepthAttachment](){
+                if(depthAttachment)
+                    StateCache::deleteTexture(depthAttachment);
+                if(rendererID)
+                    StateCache::deleteFramebuffer(rendererID);
+            });
             m_DepthAttachment = 0;
-        }
-        if(m_RendererID){
-            glDeleteFramebuffers(1, &m_RendererID);
             m_RendererID = 0;
         }
 
-        glCreateFramebuffers(1, &m_RendererID);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+        /* The color attachment is a regular texture, so the Renderer2D can draw it like any other */
+        m_ColorAttachment = GEOGL::Texture2D::create(m_FramebufferSpecification.width, m_FramebufferSpecification.height);
 
-        glCreateTextures(GL_TEXTURE_2D, 1, &m_ColorAttachment);
-        glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, (GLsizei)m_FramebufferSpecification.width, (GLsizei)m_FramebufferSpecification.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        /* Set up through the names of the objects, so the bound framebuffer and textures are left alone */
+        RenderThread::execute([&](){
+            glCreateFramebuffers(1, &m_RendererID);
 
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachment, 0);
+            glTextureParameteri(m_ColorAttachment->getRendererID(), GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(m_ColorAttachment->getRendererID(), GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(m_ColorAttachment->getRendererID(), GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glCreateTextures(GL_TEXTURE_2D, 1, &m_DepthAttachment);
-        glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
-        glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, (GLsizei)m_FramebufferSpecification.width, (GLsizei)m_FramebufferSpecification.height);
-        // glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, m_Specification.Width, m_Specification.Height, 0,
-        // 	GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, NULL);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthAttachment, 0);
+            glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, m_ColorAttachment->getRendererID(), 0);
 
-        GEOGL_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
+            glCreateTextures(GL_TEXTURE_2D, 1, &m_DepthAttachment);
+            glTextureStorage2D(m_DepthAttachment, 1, GL_DEPTH24_STENCIL8, (GLsizei)m_FramebufferSpecification.width, (GLsizei)m_FramebufferSpecification.height);
+            // glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, m_Specification.Width, m_Specification.Height, 0,
+            // 	GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, NULL);
+            glNamedFramebufferTexture(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, m_DepthAttachment, 0);
 
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            GEOGL_CORE_ASSERT(glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
+        });
     }
 
     void Framebuffer::resize(uint32_t width, uint32_t height){
@@ -42,13 +42,15 @@ namespace GEOGL::Platform::OpenGL{
 
         void resize(uint32_t width, uint32_t height) override;
 
-        [[nodiscard]] inline uint32_t getColorAttachmentRendererID() const override {return m_ColorAttachment; };
+        [[nodiscard]] inline uint32_t getColorAttachmentRendererID() const override {return m_ColorAttachment->getRendererID(); };
+        [[nodiscard]] inline const Ref<GEOGL::Texture2D>& getColorAttachment() const override { return m_ColorAttachment; };
 
         [[nodiscard]] const FramebufferSpecification& getFramebufferSpecification() const override;
 
     private:
         uint32_t m_RendererID = 0;
-        uint32_t m_ColorAttachment = 0, m_DepthAttachment = 0;
+        Ref<GEOGL::Texture2D> m_ColorAttachment;
+        uint32_t m_DepthAttachment = 0;
         FramebufferSpecification m_FramebufferSpecification;
 
     };
@@ -26,6 +26,8 @@
 #include <GLFW/glfw3.h>
 #include <GL/gl.h>
 #include "OpenGLGraphicsContext.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
 
 namespace GEOGL::Platform::OpenGL{
 
@@ -123,28 +125,50 @@ namespace GEOGL::Platform::OpenGL{
     void GraphicsContext::setViewport(const glm::ivec2& topLeftCorner, const glm::ivec2& dimensions){
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glViewport(topLeftCorner.x, topLeftCorner.y, dimensions.x, dimensions.y);
+        RenderThread::submit([topLeftCorner, dimensions](){
+            StateCache::viewport(topLeftCorner.x, topLeftCorner.y, dimensions.x, dimensions.y);
+        });
     }
 
     void GraphicsContext::clearColor(){
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glClearColor(.1f,.1f,.1f,1);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        RenderThread::submit([](){
+            StateCache::clearColor({.1f,.1f,.1f,1});
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        });
 
     }
 
     void GraphicsContext::setVSync(bool* vSyncStatus){
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glfwSwapInterval(*vSyncStatus);
+        int interval = *vSyncStatus;
+        RenderThread::submit([interval](){
+            glfwSwapInterval(interval);
+        });
 
     }
 
     void GraphicsContext::swapBuffers() {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glfwSwapBuffers(m_WindowHandle);
+        GLFWwindow* windowHandle = m_WindowHandle;
+        RenderThread::submit([windowHandle](){
+            glfwSwapBuffers(windowHandle);
+        });
+
+    }
+
+    void GraphicsContext::makeCurrent() {
+
+        glfwMakeContextCurrent(m_WindowHandle);
+
+    }
+
+    void GraphicsContext::releaseCurrent() {
+
+        glfwMakeContextCurrent(nullptr);
 
     }
 
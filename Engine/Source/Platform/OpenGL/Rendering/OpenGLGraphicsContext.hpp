@@ -45,6 +45,9 @@ namespace GEOGL::Platform::OpenGL{
         void setVSync(bool* vSyncStatus) override;
         void swapBuffers() override;
 
+        void makeCurrent() override;
+        void releaseCurrent() override;
+
         void deInitGlad();
 
     private:
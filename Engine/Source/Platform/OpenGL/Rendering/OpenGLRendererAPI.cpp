@@ -23,9 +23,31 @@
  *******************************************************************************/
 #include <glad/glad.h>
 #include "OpenGLRendererAPI.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
+#if GEOGL_BUILD_WITH_GLFW == 1
+#include <GLFW/glfw3.h>
+#endif
+
+/* From GL_KHR_parallel_shader_compile, which the loader does not include */
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
 
 namespace GEOGL::Platform::OpenGL{
 
+    /* Lets the driver compile shaders on as many threads as it wants, instead of its default */
+    static void enableParallelShaderCompile(){
+
+#if GEOGL_BUILD_WITH_GLFW == 1
+        auto maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+        if(!maxShaderCompilerThreads)
+            maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+
+        if(maxShaderCompilerThreads)
+            maxShaderCompilerThreads(0xFFFFFFFF);
+#endif
+
+    }
+
 
     /* Since this is the OpenGL Rendering api, we know the api is OpenGL */
     RendererAPI::RendererAPI() : GEOGL::RendererAPI(RENDERING_OPENGL_DESKTOP){
@@ -41,9 +63,11 @@ namespace GEOGL::Platform::OpenGL{
 
         GEOGL_CORE_INFO("Initializing the RendererAPI");
 
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        glEnable(GL_DEPTH_TEST);
+        /* The context may not be new, so nothing is assumed about what is already set */
+        StateCache::invalidate();
+        StateCache::setEnabled(GL_BLEND, true);
+        StateCache::blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        StateCache::setEnabled(GL_DEPTH_TEST, true);
 
         /* Log GPU information */
         {
@@ -54,6 +78,62 @@ namespace GEOGL::Platform::OpenGL{
             GEOGL_CORE_INFO_NOSTRIP("   GLSL Version {}.", (const char *) glGetString(GL_SHADING_LANGUAGE_VERSION));
         }
 
+        queryCapabilities();
+
+        if(m_Capabilities.parallelShaderCompile)
+            enableParallelShaderCompile();
+
+    }
+
+    void RendererAPI::queryCapabilities(){
+        GEOGL_PROFILE_FUNCTION();
+
+        auto getInteger = [](GLenum name){
+            GLint value = 0;
+            glGetIntegerv(name, &value);
+            return (uint32_t) std::max(value, 0);
+        };
+
+        RenderCaps& caps = m_Capabilities;
+
+        caps.maxTextureImageUnits = getInteger(GL_MAX_TEXTURE_IMAGE_UNITS);
+        caps.maxCombinedTextureImageUnits = getInteger(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS);
+        caps.maxTextureSize = getInteger(GL_MAX_TEXTURE_SIZE);
+        caps.maxArrayTextureLayers = getInteger(GL_MAX_ARRAY_TEXTURE_LAYERS);
+
+        caps.maxVertexAttributes = getInteger(GL_MAX_VERTEX_ATTRIBS);
+        caps.maxElementsVertices = getInteger(GL_MAX_ELEMENTS_VERTICES);
+        caps.maxElementsIndices = getInteger(GL_MAX_ELEMENTS_INDICES);
+        caps.maxUniformBlockSize = getInteger(GL_MAX_UNIFORM_BLOCK_SIZE);
+        caps.uniformBufferOffsetAlignment = std::max(getInteger(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT), 1u);
+        caps.maxTextureBufferSize = getInteger(GL_MAX_TEXTURE_BUFFER_SIZE);
+
+        if(GLAD_GL_VERSION_4_3){
+            GLint64 maxShaderStorageBlockSize = 0;
+            glGetInteger64v(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &maxShaderStorageBlockSize);
+            caps.maxShaderStorageBlockSize = (uint64_t) std::max<GLint64>(maxShaderStorageBlockSize, 0);
+        }
+
+        caps.extensions.clear();
+        uint32_t extensionCount = getInteger(GL_NUM_EXTENSIONS);
+        for(uint32_t i = 0; i < extensionCount; ++i){
+            caps.extensions.emplace((const char*) glGetStringi(GL_EXTENSIONS, i));
+        }
+
+        caps.bufferStorage = GLAD_GL_VERSION_4_4 || caps.hasExtension("GL_ARB_buffer_storage");
+        caps.directStateAccess = GLAD_GL_VERSION_4_5 || caps.hasExtension("GL_ARB_direct_state_access");
+        caps.baseInstance = GLAD_GL_VERSION_4_2 || caps.hasExtension("GL_ARB_base_instance");
+        caps.copyImage = GLAD_GL_VERSION_4_3 || caps.hasExtension("GL_ARB_copy_image");
+        caps.bindlessTexture = caps.hasExtension("GL_ARB_bindless_texture");
+        caps.parallelShaderCompile = caps.hasExtension("GL_KHR_parallel_shader_compile") || caps.hasExtension("GL_ARB_parallel_shader_compile");
+
+        GEOGL_CORE_INFO_NOSTRIP("OpenGL Capabilities:");
+        GEOGL_CORE_INFO_NOSTRIP("   Fragment Texture Units: {}, Combined: {}", caps.maxTextureImageUnits, caps.maxCombinedTextureImageUnits);
+        GEOGL_CORE_INFO_NOSTRIP("   Max Texture Size: {}, Array Layers: {}", caps.maxTextureSize, caps.maxArrayTextureLayers);
+        GEOGL_CORE_INFO_NOSTRIP("   Recommended Batch: {} vertices, {} indices", caps.maxElementsVertices, caps.maxElementsIndices);
+        GEOGL_CORE_INFO_NOSTRIP("   Buffer Storage: {}, DSA: {}, Base Instance: {}, Copy Image: {}, Bindless Textures: {}, Parallel Shader Compile: {}",
+                                caps.bufferStorage, caps.directStateAccess, caps.baseInstance, caps.copyImage, caps.bindlessTexture, caps.parallelShaderCompile);
+
     }
 
     void RendererAPI::shutdown(){
@@ -65,7 +145,10 @@ namespace GEOGL::Platform::OpenGL{
     void RendererAPI::setViewport(const glm::ivec2 &dimensions) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glViewport(0,0,(GLsizei) dimensions.x, (GLsizei) dimensions.y);
+        RenderThread::submit([dimensions](){
+            StateCache::viewport(0,0,(GLsizei) dimensions.x, (GLsizei) dimensions.y);
+        });
+        m_Viewport = dimensions;
 
     }
 
@@ -76,27 +159,60 @@ namespace GEOGL::Platform::OpenGL{
     void RendererAPI::clear() {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glClearColor(m_ClearColor.r, m_ClearColor.g, m_ClearColor.b, m_ClearColor.a);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glm::vec4 clearColor = m_ClearColor;
+        RenderThread::submit([clearColor](){
+            StateCache::clearColor(clearColor);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        });
 
     }
 
-    void RendererAPI::drawIndexed(const Ref<VertexArray> &vertexArray, uint32_t indexCount) {
+    void RendererAPI::drawIndexed(const Ref<VertexArray> &vertexArray, uint32_t indexCount, uint32_t baseVertex) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
         GLsizei count = indexCount ? (GLsizei) indexCount : (GLsizei) vertexArray->getIndexBuffer()->getCount();
 
-        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+        RenderThread::submit([count, baseVertex](){
+            if(baseVertex)
+                glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, (GLint) baseVertex);
+            else
+                glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+        });
+
+    }
+
+    void RendererAPI::drawIndexedInstanced(const Ref<VertexArray> &vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        GLsizei count = indexCount ? (GLsizei) indexCount : (GLsizei) vertexArray->getIndexBuffer()->getCount();
+
+        RenderThread::submit([count, instanceCount, baseInstance](){
+            if(baseInstance)
+                glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, (GLsizei) instanceCount, (GLuint) baseInstance);
+            else
+                glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, (GLsizei) instanceCount);
+        });
+
+    }
+
+    StateChangeStatistics RendererAPI::getStateChangeStatistics() const {
+
+        return StateCache::getStatistics();
+
+    }
+
+    void RendererAPI::resetStateChangeStatistics() {
+
+        StateCache::resetStatistics();
 
     }
 
     void RendererAPI::renderWireframe(bool *status) {
 
-        if(*status){
-            glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-        }else{
-            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-        }
+        bool wireframe = *status;
+        RenderThread::submit([wireframe](){
+            StateCache::polygonMode(wireframe ? GL_LINE : GL_FILL);
+        });
 
     }
 
@@ -48,11 +48,17 @@ namespace GEOGL::Platform::OpenGL{
         void setClearColor(const glm::vec4& color) override;
         void clear() override;
 
-        virtual void drawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+        virtual void drawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+        virtual void drawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
         virtual void renderWireframe(bool* status) override;
 
+        StateChangeStatistics getStateChangeStatistics() const override;
+        void resetStateChangeStatistics() override;
+
+    private:
+        void queryCapabilities();
+
     private:
-        glm::vec4 m_ClearColor;
 
 
     };
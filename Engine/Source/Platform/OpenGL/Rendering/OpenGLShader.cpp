@@ -24,12 +24,23 @@
 
 #include <glad/glad.h>
 #include "OpenGLShader.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
+#include "../../../GEOGL/Rendering/RenderCommand.hpp"
+#if GEOGL_CACHE_COMPILED_SHADERS == 1
+#include "OpenGLShaderCache.hpp"
+#endif
 #include <array>
 #include <glm/gtc/type_ptr.hpp>
 
 #include <fstream>
 #include <utility>
 
+/* From GL_KHR_parallel_shader_compile, which the loader does not include */
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 namespace GEOGL::Platform::OpenGL{
 
     static GLenum shaderTypeFromString(const std::string& type){
@@ -51,6 +62,34 @@ namespace GEOGL::Platform::OpenGL{
 
     }
 
+    static std::string nameFromFolderPath(const std::string& folderPath){
+
+        auto lastSlash = folderPath.find_last_of("/\\");
+        lastSlash = lastSlash == std::string::npos ? 0 : lastSlash +1;
+        return folderPath.substr(lastSlash);
+
+    }
+
+    /* Runs job for every index, spread over up to one thread per core */
+    static void runOnWorkers(size_t count, const std::function<void(size_t)>& job){
+
+        std::atomic<size_t> next = 0;
+        auto worker = [&](){
+            for(size_t i = next++; i < count; i = next++)
+                job(i);
+        };
+
+        size_t workerCount = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<std::thread> workers;
+        for(size_t i = 1; i < workerCount; ++i)
+            workers.emplace_back(worker);
+
+        worker();
+        for(auto& thread : workers)
+            thread.join();
+
+    }
+
     GLenum shaderDataTypeToOpenGLBaseType(enum ShaderDataType type){
         switch(type){
             case ShaderDataType::FLOAT:
@@ -67,6 +106,15 @@ namespace GEOGL::Platform::OpenGL{
                 return GL_INT;
             case ShaderDataType::BOOLEAN:
                 return GL_BOOL;
+            case ShaderDataType::UINT:
+                return GL_UNSIGNED_INT;
+            case ShaderDataType::UBYTE4:
+                return GL_UNSIGNED_BYTE;
+            case ShaderDataType::USHORT:
+            case ShaderDataType::USHORT2:
+                return GL_UNSIGNED_SHORT;
+            case ShaderDataType::HALF:
+                return GL_HALF_FLOAT;
             default:
             GEOGL_CORE_ASSERT(false, "Unknown shader DataType");
                 return 0;
@@ -84,245 +132,316 @@ namespace GEOGL::Platform::OpenGL{
 
     }
 
-    Shader::Shader(const std::string& folderPath){
+    Shader::Shader(const std::string& folderPath, const ShaderDefines& defines){
         GEOGL_PROFILE_FUNCTION();
 
-        /* first, read the source */
-        std::string fileToLoad = folderPath+"/shader.glsl";
-        GEOGL_CORE_INFO("Loading shader {}", fileToLoad);
-        std::string source = readFile(fileToLoad);
+        /* first, read the source, resolving its includes and defines */
+        GEOGL_CORE_INFO("Loading shader {}/shader.glsl", folderPath);
+        std::string source = loadSource(folderPath, defines);
+
+        m_Name = nameFromFolderPath(folderPath);
 
         auto shaderSources = preprocess(source);
 
         compile(shaderSources);
 
-        /* Get the name from the folder path */
-        auto lastSlash = folderPath.find_last_of("/\\");
-        lastSlash = lastSlash == std::string::npos ? 0 : lastSlash +1;
-        auto count = folderPath.size() - lastSlash;
+    }
 
-        m_Name = folderPath.substr(lastSlash, count);
+
+    Shader::Shader(const std::string& source, std::string name) : m_Name(std::move(name)){
+        GEOGL_PROFILE_FUNCTION();
+
+        auto shaderSources = preprocess(source);
+
+        compile(shaderSources);
 
     }
 
+    Shader::Shader(const std::unordered_map<GLenum, std::string>& shaderSources, std::string name) : m_Name(std::move(name)){
+        GEOGL_PROFILE_FUNCTION();
 
-    Shader::~Shader() {
+        beginCompile(shaderSources);
+
+    }
+
+    std::vector<Ref<GEOGL::Shader>> Shader::createBatch(const std::vector<std::string>& folderPaths){
         GEOGL_PROFILE_FUNCTION();
 
-        for(auto& kv : shaderIDs){
-            glDetachShader(m_RendererID, kv);
-        }
-        for(auto& kv : shaderIDs){
-            glDeleteShader(kv);
+        std::vector<std::unordered_map<GLenum, std::string>> shaderSources(folderPaths.size());
+        runOnWorkers(folderPaths.size(), [&](size_t i){
+            GEOGL_CORE_INFO("Loading shader {}/shader.glsl", folderPaths[i]);
+            shaderSources[i] = preprocess(loadSource(folderPaths[i]));
+        });
+
+        /* Start every program before waiting on any, which is when the driver can compile them in parallel */
+        std::vector<Ref<GEOGL::Shader>> shaders;
+        shaders.reserve(folderPaths.size());
+        for(size_t i = 0; i < folderPaths.size(); ++i){
+            shaders.push_back(createRef<Shader>(shaderSources[i], nameFromFolderPath(folderPaths[i])));
         }
 
-        glDeleteProgram(m_RendererID);
-        setBoundID(0);
+        return shaders;
+
+    }
+
+    bool Shader::isReady() {
+
+        if(!m_Pending)
+            return true;
+
+        /* Without parallel shader compile the driver cannot be asked, and the first use waits for the link */
+        if(!RenderCommand::getCapabilities().parallelShaderCompile)
+            return true;
+
+        GLint isComplete = GL_TRUE;
+        RenderThread::execute([&](){
+            glGetProgramiv(m_RendererID, GL_COMPLETION_STATUS_KHR, &isComplete);
+        });
+
+        if(isComplete == GL_FALSE)
+            return false;
+
+        finishCompile();
+        return true;
+
+    }
+
+    Shader::~Shader() {
+        GEOGL_PROFILE_FUNCTION();
+
+        RenderThread::submit([rendererID = m_RendererID, shaderIDs = shaderIDs](){
+            for(auto& kv : shaderIDs){
+                glDetachShader(rendererID, kv);
+            }
+            for(auto& kv : shaderIDs){
+                glDeleteShader(kv);
+            }
+
+            StateCache::deleteProgram(rendererID);
+        });
 
     }
 
     void Shader::bind() const {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        if(m_RendererID != getBoundID()) {
-            glUseProgram(m_RendererID);
-            setBoundID(m_RendererID);
-        }
+        /* Finishing a pending compile only completes what the constructor started */
+        const_cast<Shader*>(this)->finishCompile();
+
+        RenderThread::submit([rendererID = m_RendererID](){
+            StateCache::useProgram(rendererID);
+        });
 
     }
 
     void Shader::unbind() const {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        setBoundID(0);
-        glUseProgram(0);
+        RenderThread::submit([](){
+            StateCache::useProgram(0);
+        });
 
     }
 
-    void Shader::setInt(const char *name, int value){
+    void Shader::setInt(UniformID uniform, int value){
 
-        uploadUniformInt(name, value);
+        uploadUniformInt(uniform, value);
 
     }
 
-    void Shader::setIntArray(const char * name, int* values, uint32_t count){
+    void Shader::setIntArray(UniformID uniform, int* values, uint32_t count){
 
-        uploadUniformIntArray(name, values, count);
+        uploadUniformIntArray(uniform, values, count);
 
     }
 
-    void Shader::setFloat(const char *name, float value) {
+    void Shader::setFloat(UniformID uniform, float value){
 
-        uploadUniformFloat(name, value);
+        uploadUniformFloat(uniform, value);
 
     }
 
-    void Shader::setFloat2(const char * name, const glm::vec2 &value) {
+    void Shader::setFloat2(UniformID uniform, const glm::vec2 &value){
 
-        uploadUniformFloat2(name, value);
+        uploadUniformFloat2(uniform, value);
 
     }
 
-    void Shader::setFloat3(const char * name, const glm::vec3 &value) {
+    void Shader::setFloat3(UniformID uniform, const glm::vec3 &value){
 
-        uploadUniformFloat3(name, value);
+        uploadUniformFloat3(uniform, value);
 
     }
 
-    void Shader::setFloat4(const char * name, const glm::vec4 &value) {
+    void Shader::setFloat4(UniformID uniform, const glm::vec4 &value){
 
-        uploadUniformFloat4(name, value);
+        uploadUniformFloat4(uniform, value);
 
     }
 
-    void Shader::setMat4(const char * name, const glm::mat4 &value) {
+    void Shader::setMat4(UniformID uniform, const glm::mat4 &value){
 
-        uploadUniformMat4(name, value);
+        uploadUniformMat4(uniform, value);
 
     }
 
-    void Shader::uploadUniformInt(const char *uniformName, int value) {
-        GEOGL_RENDERER_PROFILE_FUNCTION();
+    GLint Shader::getUniformLocation(UniformID uniform) {
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        finishCompile();
 
-        /* now, upload the data */
-        glUniform1i(uniformLocation, value);
+        if(m_Uniforms.empty())
+            return -1;
 
-    }
+        for(uint32_t slot = uniform.getHash() & m_UniformMask;; slot = (slot + 1) & m_UniformMask){
+            const Uniform& entry = m_Uniforms[slot];
+            if(entry.location == -1 || entry.hash == uniform.getHash())
+                return entry.location;
+        }
 
-    void Shader::uploadUniformIntArray(const char * uniformName, int* values, uint32_t count){
+    }
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+    void Shader::uploadUniformInt(UniformID uniform, int value) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        GEOGL_CORE_ASSERT(uniformLocation != -1, "Uniform {} not found.", uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform1uiv(uniformLocation, (GLsizei)count, (GLuint*) values);
+        RenderThread::submit([rendererID = m_RendererID, location, value](){
+            glProgramUniform1i(rendererID, location, value);
+        });
 
     }
 
-    void Shader::uploadUniformInt2(const char *uniformName, const glm::ivec2& vector) {
+    void Shader::uploadUniformIntArray(UniformID uniform, int* values, uint32_t count){
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        GEOGL_CORE_ASSERT(location != -1, "Uniform {:#x} not found in shader {}.", uniform.getHash(), m_Name);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform2iv(uniformLocation, 1, glm::value_ptr(vector));
+        auto stagedValues = (const GLint*) RenderThread::stage(values, count * sizeof(int));
+        RenderThread::submit([rendererID = m_RendererID, location, stagedValues, count](){
+            glProgramUniform1iv(rendererID, location, (GLsizei)count, stagedValues);
+        });
 
     }
 
-    void Shader::uploadUniformInt3(const char *uniformName, const glm::ivec3& vector) {
+    void Shader::uploadUniformInt2(UniformID uniform, const glm::ivec2& vector) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform3iv(uniformLocation, 1, glm::value_ptr(vector));
+        RenderThread::submit([rendererID = m_RendererID, location, vector](){
+            glProgramUniform2iv(rendererID, location, 1, glm::value_ptr(vector));
+        });
 
     }
 
-    void Shader::uploadUniformInt4(const char *uniformName, const glm::ivec4& vector) {
+    void Shader::uploadUniformInt3(UniformID uniform, const glm::ivec3& vector) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform4iv(uniformLocation, 1, glm::value_ptr(vector));
+        RenderThread::submit([rendererID = m_RendererID, location, vector](){
+            glProgramUniform3iv(rendererID, location, 1, glm::value_ptr(vector));
+        });
 
     }
 
-    void Shader::uploadUniformFloat(const char *uniformName, float value) {
+    void Shader::uploadUniformInt4(UniformID uniform, const glm::ivec4& vector) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform1f(uniformLocation, value);
+        RenderThread::submit([rendererID = m_RendererID, location, vector](){
+            glProgramUniform4iv(rendererID, location, 1, glm::value_ptr(vector));
+        });
 
     }
 
-    void Shader::uploadUniformFloat2(const char *uniformName, const glm::vec2 &vector) {
+    void Shader::uploadUniformFloat(UniformID uniform, float value) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform2fv(uniformLocation, 1, glm::value_ptr(vector));
+        RenderThread::submit([rendererID = m_RendererID, location, value](){
+            glProgramUniform1f(rendererID, location, value);
+        });
 
     }
 
-    void Shader::uploadUniformFloat3(const char *uniformName, const glm::vec3 &vector) {
+    void Shader::uploadUniformFloat2(UniformID uniform, const glm::vec2 &vector) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        bind();
-
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform3fv(uniformLocation, 1, glm::value_ptr(vector));
+        RenderThread::submit([rendererID = m_RendererID, location, vector](){
+            glProgramUniform2fv(rendererID, location, 1, glm::value_ptr(vector));
+        });
 
     }
 
-    void Shader::uploadUniformFloat4(const char *uniformName, const glm::vec4 &vector) {
+    void Shader::uploadUniformFloat3(UniformID uniform, const glm::vec3 &vector) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniform4fv(uniformLocation, 1, glm::value_ptr(vector));
+        RenderThread::submit([rendererID = m_RendererID, location, vector](){
+            glProgramUniform3fv(rendererID, location, 1, glm::value_ptr(vector));
+        });
 
     }
 
-    void Shader::uploadUniformMat3(const char *uniformName, const glm::mat3 &matrix) {
+    void Shader::uploadUniformFloat4(UniformID uniform, const glm::vec4 &vector) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Get the uniform's location */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniformMatrix3fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(matrix));
+        RenderThread::submit([rendererID = m_RendererID, location, vector](){
+            glProgramUniform4fv(rendererID, location, 1, glm::value_ptr(vector));
+        });
 
     }
 
-    void Shader::uploadUniformMat4(const char *uniformName, const glm::mat4 &matrix) {
+    void Shader::uploadUniformMat3(UniformID uniform, const glm::mat3 &matrix) {
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        /* Tried caching uniforms. It was about 15% slower. So, just query OpenGL every frame */
-        int uniformLocation = glGetUniformLocation(m_RendererID, uniformName);
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        /* now, upload the data */
-        glUniformMatrix4fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(matrix));
+        RenderThread::submit([rendererID = m_RendererID, location, matrix](){
+            glProgramUniformMatrix3fv(rendererID, location, 1, GL_FALSE, glm::value_ptr(matrix));
+        });
 
     }
 
-    std::string Shader::readFile(const std::string& filePath){
-        GEOGL_PROFILE_FUNCTION();
-
-        std::string result;
-        std::ifstream in(filePath, std::ios::in | std::ios::binary);
-        GEOGL_CORE_ASSERT(in, "Could not open shader file {}", filePath);
-        if(!in){
-            GEOGL_CORE_ERROR_NOSTRIP("Could not find shader {}", filePath);
-            return "";
-        }
+    void Shader::uploadUniformMat4(UniformID uniform, const glm::mat4 &matrix) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        in.seekg(0, std::ios::end);
-        result.resize(in.tellg());
-        in.seekg(0, std::ios::beg);
-        in.read(&result[0], (std::streamsize)result.size());
-        in.close();
+        GLint location = getUniformLocation(uniform);
+        if(location == -1)
+            return;
 
-        return result;
+        RenderThread::submit([rendererID = m_RendererID, location, matrix](){
+            glProgramUniformMatrix4fv(rendererID, location, 1, GL_FALSE, glm::value_ptr(matrix));
+        });
 
     }
 
@@ -346,131 +465,259 @@ namespace GEOGL::Platform::OpenGL{
             shaderSources[shaderTypeFromString(type)] = source.substr(nextLinePos, pos - (nextLinePos == std::string::npos ? source.size() -1 : nextLinePos));
         }
 
-        /* Default shader, really flipping obnoxious */
-        if(shaderSources.find(GL_FRAGMENT_SHADER) == shaderSources.end()){
-            shaderSources[GL_FRAGMENT_SHADER] = R"(
-#version 330 core
+        /* A missing stage is a broken shader, so say so rather than linking something that draws the wrong thing */
+        bool complete = shaderSources.find(GL_VERTEX_SHADER) != shaderSources.end() && shaderSources.find(GL_FRAGMENT_SHADER) != shaderSources.end();
+        GEOGL_CORE_ASSERT(complete, "A shader needs both a #type vertex and a #type fragment stage");
+        if(!complete)
+            GEOGL_CORE_ERROR_NOSTRIP("A shader needs both a #type vertex and a #type fragment stage");
 
-layout(location = 0) out vec4 color;
+        return shaderSources;
 
-void main()
-{
-    color = vec4(1.0f,0.0f,0.5f,1.0f);
-}
+    }
 
-)";
-        }
+    void Shader::compile(const std::unordered_map<GLenum, std::string>& shaderSources) {
+        GEOGL_PROFILE_FUNCTION();
 
-        /* Default shader, really flipping obnoxious */
-        if(shaderSources.find(GL_VERTEX_SHADER) == shaderSources.end()){
-            shaderSources[GL_VERTEX_SHADER] = R"(
-#version 330 core
+        beginCompile(shaderSources);
+        finishCompile();
 
-layout(location = 0) in vec3 a_Position;
+    }
 
-void main()
-{
-    gl_Position = vec4(a_Position.xyz,1.0f);
-}
+    void Shader::beginCompile(const std::unordered_map<GLenum, std::string>& shaderSources) {
+        GEOGL_PROFILE_FUNCTION();
 
-)";
-        }
+        /* Compiling creates the program, so it runs on the render thread, and the program exists when this returns */
+        RenderThread::execute([&](){
+            /* create a program */
+            {
+                GEOGL_RENDERER_PROFILE_SCOPE("Create Program");
+                m_RendererID = glCreateProgram();
+            }
 
+#if GEOGL_CACHE_COMPILED_SHADERS == 1
+            /* Try the compiled shader cache before compiling anything */
+            m_StoreInCache = ShaderCache::isSupported();
+            if(m_StoreInCache){
+                m_CacheKey = ShaderCache::computeKey(shaderSources);
 
-        return shaderSources;
+                bool rejected = false;
+                if(ShaderCache::load(m_RendererID, m_CacheKey, rejected)){
+                    ++s_CacheStatistics.hits;
+                    GEOGL_CORE_INFO("Loaded shader {} from the compiled shader cache.", m_Name);
 
-    }
+                    m_StoreInCache = false;
+                    reflectUniforms();
+                    return;
+                }
 
-    void Shader::compile(const std::unordered_map<GLenum, std::string>& shaderSources) {
-        GEOGL_PROFILE_FUNCTION();
+                ++s_CacheStatistics.misses;
+                if(rejected){
+                    ++s_CacheStatistics.rejections;
+                    GEOGL_CORE_WARN("The driver rejected the cached binary of shader {}. Compiling it again.", m_Name);
+                }else{
+                    GEOGL_CORE_INFO("Shader {} is not in the compiled shader cache. Compiling it.", m_Name);
+                }
 
-        GLuint programID = 0;
-        /* create a program */
-        {
-            GEOGL_RENDERER_PROFILE_SCOPE("Create Program");
-            programID = glCreateProgram();
-        }
+                glProgramParameteri(m_RendererID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            }
+#endif
 
-        GEOGL_CORE_ASSERT(shaderSources.size() <=2, "We only support 4 shader components at a time!");
-        uint32_t glShaderIDIndex = 0;
-        {
-            GEOGL_PROFILE_SCOPE("Compiling shaders");
+            GEOGL_CORE_ASSERT(shaderSources.size() <=2, "We only support 4 shader components at a time!");
+            uint32_t glShaderIDIndex = 0;
+            {
+                GEOGL_PROFILE_SCOPE("Compiling shaders");
 
-            for (auto &kv: shaderSources) {
-                GLenum type = kv.first;
-                const std::string &source = kv.second;
+                /* Only issue the compiles. Nothing is checked until the program has linked, so the driver can work
+                 * on every stage, and with parallel shader compile on every program, at the same time */
+                for (auto &kv: shaderSources) {
+                    GLenum type = kv.first;
+                    const std::string &source = kv.second;
 
-                GLuint shaderID = glCreateShader(type);
+                    GLuint shaderID = glCreateShader(type);
 
-                /* Send the vertex shader source code to GL */
-                const GLchar *sourceCstr = source.c_str();
-                glShaderSource(shaderID, 1, &sourceCstr, nullptr);
+                    /* Send the shader source code to GL */
+                    const GLchar *sourceCstr = source.c_str();
+                    glShaderSource(shaderID, 1, &sourceCstr, nullptr);
+                    glCompileShader(shaderID);
 
-                /* Compile the vertex shader */
-                glCompileShader(shaderID);
+                    shaderIDs[glShaderIDIndex++] = shaderID;
 
-                GLint isCompiled = 0;
-                glGetShaderiv(shaderID, GL_COMPILE_STATUS, &isCompiled);
-                if (isCompiled == GL_FALSE) {
-                    GLint maxLength = 0;
-                    glGetShaderiv(shaderID, GL_INFO_LOG_LENGTH, &maxLength);
+                    /* Attach our shaders to our m_RenderID */
+                    glAttachShader(m_RendererID, shaderID);
 
-                    // The maxLength includes the NULL character
-                    std::string infoLog;
-                    infoLog.resize(maxLength);
-                    glGetShaderInfoLog(shaderID, maxLength, &maxLength, infoLog.data());
+                }
+            }
+
+            /* Link our m_RenderID */
+            {
+                GEOGL_PROFILE_SCOPE("Linking shader");
+                glLinkProgram(m_RendererID);
+            }
+
+            m_Pending = true;
+        });
+
+    }
+
+    void Shader::finishCompile() {
+
+        if(!m_Pending)
+            return;
 
-                    // We don't need the shader anymore.
-                    glDeleteShader(shaderID);
-                    for (auto &toDelete : shaderIDs) {
-                        glDeleteShader(toDelete);
+        GEOGL_PROFILE_FUNCTION();
+
+        m_Pending = false;
+        RenderThread::execute([&](){
+            /* Note the different functions here: glGetProgram* instead of glGetShader* */
+            GLint isLinked = 0;
+            glGetProgramiv(m_RendererID, GL_LINK_STATUS, (int *)&isLinked);
+            if (isLinked == GL_FALSE){
+                /* A stage that did not compile explains the failure better than the link does */
+                std::string infoLog;
+                for(auto shaderID : shaderIDs){
+                    GLint isCompiled = GL_TRUE;
+                    if(shaderID != 0)
+                        glGetShaderiv(shaderID, GL_COMPILE_STATUS, &isCompiled);
+                    if(isCompiled == GL_FALSE){
+                        GLint maxLength = 0;
+                        glGetShaderiv(shaderID, GL_INFO_LOG_LENGTH, &maxLength);
+
+                        /* The maxLength includes the NULL character */
+                        infoLog.resize(maxLength);
+                        glGetShaderInfoLog(shaderID, maxLength, &maxLength, infoLog.data());
+                        infoLog = "Unable to compile Shader: " + infoLog;
+                        break;
                     }
+                }
+
+                if(infoLog.empty()){
+                    GLint maxLength = 0;
+                    glGetProgramiv(m_RendererID, GL_INFO_LOG_LENGTH, &maxLength);
 
-                    // Use the infoLog as you see fit.
-                    GEOGL_CORE_ASSERT(false, "Unable to compile Shader: {}", infoLog);
+                    /* The maxLength includes the NULL character */
+                    infoLog.resize(maxLength);
+                    glGetProgramInfoLog(m_RendererID, maxLength, &maxLength, infoLog.data());
+                    infoLog = "Unable to Link shaders: " + infoLog;
                 }
 
-                shaderIDs[glShaderIDIndex++] = shaderID;
+                /* We don't need the m_RenderID anymore. */
+                StateCache::deleteProgram(m_RendererID);
+                for(auto& kv : shaderIDs){
+                    glDeleteShader(kv);
+                    kv = 0;
+                }
+                m_RendererID = 0;
 
-                /* Attach our shaders to our m_RenderID */
-                glAttachShader(programID, shaderID);
+                GEOGL_CORE_ASSERT(false, "{} ({})", infoLog, m_Name);
+                return;
 
             }
-        }
 
-        /* Link our m_RenderID */
-        {
-            GEOGL_PROFILE_SCOPE("Linking shader");
-            glLinkProgram(programID);
-        }
+            for(auto shaderID:shaderIDs){
+                glDetachShader(m_RendererID,shaderID);
+            }
 
-        /* Note the different functions here: glGetProgram* instead of glGetShader* */
-        GLint isLinked = 0;
-        glGetProgramiv(programID, GL_LINK_STATUS, (int *)&isLinked);
-        if (isLinked == GL_FALSE){
-            GLint maxLength = 0;
-            glGetProgramiv(programID, GL_INFO_LOG_LENGTH, &maxLength);
+#if GEOGL_CACHE_COMPILED_SHADERS == 1
+            if(m_StoreInCache && ShaderCache::store(m_RendererID, m_CacheKey))
+                ++s_CacheStatistics.stores;
+#endif
 
-            /* The maxLength includes the NULL character */
-            std::string infoLog;
-            infoLog.resize(maxLength);
-            glGetProgramInfoLog(programID, maxLength, &maxLength, infoLog.data());
+            reflectUniforms();
+        });
 
-            /* We don't need the m_RenderID anymore. */
-            glDeleteProgram(programID);
-            for(auto& kv : shaderIDs){
-                glDeleteShader(kv);
+    }
+
+    void Shader::reflectUniforms() {
+        GEOGL_PROFILE_FUNCTION();
+
+        GLint uniformCount = 0;
+        GLint maxNameLength = 0;
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &uniformCount);
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+        /* Arrays get an entry per element, so count those first to size the table */
+        struct ActiveUniform{
+            std::string name;
+            GLint size;
+        };
+        std::vector<ActiveUniform> activeUniforms;
+        activeUniforms.reserve(uniformCount);
+        uint32_t entryCount = 0;
+
+        std::string name(std::max(maxNameLength, 1), '\0');
+        for(GLint i = 0; i < uniformCount; ++i){
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(m_RendererID, (GLuint) i, (GLsizei) name.size(), &length, &size, &type, name.data());
+
+            activeUniforms.push_back({name.substr(0, length), size});
+            entryCount += (uint32_t) size + 1;
+        }
+
+        uint32_t tableSize = 8;
+        while(tableSize < entryCount * 2)
+            tableSize <<= 1;
+
+        m_Uniforms.assign(tableSize, Uniform{});
+        m_UniformMask = tableSize - 1;
+
+        for(auto& activeUniform : activeUniforms){
+            GLint location = glGetUniformLocation(m_RendererID, activeUniform.name.c_str());
+
+            /* Members of uniform blocks have no location, and are set through their buffer */
+            if(location == -1)
+                continue;
+
+            /* Arrays are reported as "name[0]". Make the plain name and every element reachable */
+            auto arraySuffix = activeUniform.name.rfind("[0]");
+            if(arraySuffix != std::string::npos && arraySuffix + 3 == activeUniform.name.size()){
+                std::string baseName = activeUniform.name.substr(0, arraySuffix);
+                addUniform(baseName, location);
+                addUniform(activeUniform.name, location);
+                for(GLint element = 1; element < activeUniform.size; ++element){
+                    std::string elementName = GEOGL_FORMAT("{}[{}]", baseName, element);
+                    addUniform(elementName, glGetUniformLocation(m_RendererID, elementName.c_str()));
+                }
+            }else{
+                addUniform(activeUniform.name, location);
             }
+        }
 
-            GEOGL_CORE_ASSERT(false, "Unable to Link shaders: {}", infoLog);
-            return;
+        /* Point the shared blocks at their binding points */
+        GLint blockCount = 0;
+        GLint maxBlockNameLength = 0;
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+
+        std::string blockName(std::max(maxBlockNameLength, 1), '\0');
+        for(GLint i = 0; i < blockCount; ++i){
+            GLsizei length = 0;
+            glGetActiveUniformBlockName(m_RendererID, (GLuint) i, (GLsizei) blockName.size(), &length, blockName.data());
 
+            int32_t binding = getUniformBlockBinding(blockName.substr(0, length));
+            if(binding != -1)
+                glUniformBlockBinding(m_RendererID, (GLuint) i, (GLuint) binding);
         }
 
-        m_RendererID = programID;
+    }
+
+    void Shader::addUniform(const std::string& name, GLint location) {
+
+        if(location == -1)
+            return;
+
+        uint32_t hash = UniformID::hash(name.c_str());
+        for(uint32_t slot = hash & m_UniformMask;; slot = (slot + 1) & m_UniformMask){
+            Uniform& entry = m_Uniforms[slot];
+            if(entry.location == -1){
+                entry = {hash, location};
+                return;
+            }
 
-        for(auto shaderID:shaderIDs){
-            glDetachShader(m_RendererID,shaderID);
+            GEOGL_CORE_ASSERT(entry.hash != hash, "Uniform {} in shader {} collides with another uniform's hash.", name, m_Name);
+            if(entry.hash == hash)
+                return;
         }
 
     }
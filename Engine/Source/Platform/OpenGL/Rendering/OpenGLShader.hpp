@@ -35,45 +35,95 @@ namespace GEOGL::Platform::OpenGL{
     class GEOGL_API Shader : public GEOGL::Shader{
     public:
         Shader(const std::string& vertexSrc, const std::string& fragmentSrc, std::string  name);
-        Shader(const std::string& folderPath);
+        Shader(const std::string& folderPath, const ShaderDefines& defines = {});
+        Shader(const std::string& source, std::string name);
+
+        /**
+         * \brief Starts compiling and linking already preprocessed sources without waiting for either. The shader
+         * finishes when it is first used, or when isReady finds the driver done with it.
+         */
+        Shader(const std::unordered_map<GLenum, std::string>& shaderSources, std::string name);
         ~Shader() override;
 
+        /**
+         * \brief Reads and preprocesses the shaders on worker threads, then starts every compile and link before
+         * waiting for any of them.
+         */
+        static std::vector<Ref<GEOGL::Shader>> createBatch(const std::vector<std::string>& folderPaths);
+
+        bool isReady() override;
+
         void bind() const override;
         void unbind() const override;
 
-        void setInt(const char * name, int value) override;
-        void setIntArray(const char * name, int* values, uint32_t count) override;
-        void setFloat(const char * name, float value) override;
-        void setFloat2(const char * name, const glm::vec2& value) override;
-        void setFloat3(const char * name, const glm::vec3& value) override;
-        void setFloat4(const char * name, const glm::vec4& value) override;
-        void setMat4(const char * name, const glm::mat4& value) override;
+        void setInt(UniformID uniform, int value) override;
+        void setIntArray(UniformID uniform, int* values, uint32_t count) override;
+        void setFloat(UniformID uniform, float value) override;
+        void setFloat2(UniformID uniform, const glm::vec2& value) override;
+        void setFloat3(UniformID uniform, const glm::vec3& value) override;
+        void setFloat4(UniformID uniform, const glm::vec4& value) override;
+        void setMat4(UniformID uniform, const glm::mat4& value) override;
 
         const std::string & getName() const override {return m_Name;};
 
-        void uploadUniformInt(const char * uniformName, int value);
-        void uploadUniformIntArray(const char * uniformName, int* values, uint32_t count);
-        void uploadUniformInt2(const char * uniformName, const glm::ivec2& vector);
-        void uploadUniformInt3(const char * uniformName, const glm::ivec3& vector);
-        void uploadUniformInt4(const char * uniformName, const glm::ivec4& vector);
+        void uploadUniformInt(UniformID uniform, int value);
+        void uploadUniformIntArray(UniformID uniform, int* values, uint32_t count);
+        void uploadUniformInt2(UniformID uniform, const glm::ivec2& vector);
+        void uploadUniformInt3(UniformID uniform, const glm::ivec3& vector);
+        void uploadUniformInt4(UniformID uniform, const glm::ivec4& vector);
 
-        void uploadUniformFloat(const char * uniformName, float matrix);
-        void uploadUniformFloat2(const char* uniformName, const glm::vec2& vector);
-        void uploadUniformFloat3(const char * uniformName, const glm::vec3& vector);
-        void uploadUniformFloat4(const char* uniformName, const glm::vec4& vector);
+        void uploadUniformFloat(UniformID uniform, float matrix);
+        void uploadUniformFloat2(UniformID uniform, const glm::vec2& vector);
+        void uploadUniformFloat3(UniformID uniform, const glm::vec3& vector);
+        void uploadUniformFloat4(UniformID uniform, const glm::vec4& vector);
 
-        void uploadUniformMat3(const char * uniformName, const glm::mat3& matrix);
-        void uploadUniformMat4(const char * uniformName, const glm::mat4& matrix);
+        void uploadUniformMat3(UniformID uniform, const glm::mat3& matrix);
+        void uploadUniformMat4(UniformID uniform, const glm::mat4& matrix);
     private:
 
-        std::string readFile(const std::string& filePath);
-        std::unordered_map<uint32_t, std::string> preprocess(const std::string& source);
+        static std::unordered_map<uint32_t, std::string> preprocess(const std::string& source);
         void compile(const std::unordered_map<GLenum, std::string>& shaderSources);
 
+        /**
+         * \brief Issues the compile of every stage and the link of the program, without checking on either.
+         */
+        void beginCompile(const std::unordered_map<GLenum, std::string>& shaderSources);
+
+        /**
+         * \brief Waits for a pending link, reports errors, stores the program in the cache and reflects its uniforms.
+         */
+        void finishCompile();
+
+        /**
+         * \brief Reads the active uniforms of the linked program into the uniform table. Runs on the render thread.
+         */
+        void reflectUniforms();
+        void addUniform(const std::string& name, GLint location);
+
+        /**
+         * \brief Looks up the location of a uniform in the uniform table, finishing a pending compile first.
+         * \return The location of the uniform, or -1 if the shader does not use it.
+         */
+        [[nodiscard]] GLint getUniformLocation(UniformID uniform);
+
     private:
+        struct Uniform{
+            uint32_t hash = 0;
+            GLint location = -1;
+        };
+
         uint32_t m_RendererID;
         std::array<uint32_t, 4> shaderIDs{};
         std::string m_Name;
+
+        /* Set while the program is linking and has not been checked yet */
+        bool m_Pending = false;
+        bool m_StoreInCache = false;
+        uint64_t m_CacheKey = 0;
+
+        /* Open addressed by the UniformID hash. The size is a power of two, and free slots have a location of -1 */
+        std::vector<Uniform> m_Uniforms;
+        uint32_t m_UniformMask = 0;
     };
 
 }
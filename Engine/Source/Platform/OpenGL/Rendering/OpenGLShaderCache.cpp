@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <glad/glad.h>
+#include "OpenGLShaderCache.hpp"
+#include "../../../GEOGL/Rendering/Shader.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace GEOGL::Platform::OpenGL{
+
+    /* Bump whenever the entry layout changes, so old entries miss instead of being misread */
+    static const uint32_t s_EntryMagic = 0x42505347; // "GSPB"
+    static const uint32_t s_EntryVersion = 1;
+
+    struct EntryHeader{
+        uint32_t magic;
+        uint32_t version;
+        uint64_t key;
+        uint32_t binaryFormat;
+        uint32_t binaryLength;
+    };
+
+    static void hashBytes(uint64_t& hash, const void* data, size_t size){
+
+        auto bytes = (const uint8_t*) data;
+        for(size_t i = 0; i < size; ++i){
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+
+    }
+
+    static void hashString(uint64_t& hash, const char* string){
+
+        /* Include the terminator, so neighbouring strings cannot run into each other */
+        if(string)
+            hashBytes(hash, string, strlen(string) + 1);
+        else
+            hashBytes(hash, "", 1);
+
+    }
+
+    bool ShaderCache::isSupported() {
+
+        static const bool supported = [](){
+            GLint formatCount = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+            if(formatCount <= 0)
+                GEOGL_CORE_WARN_NOSTRIP("The driver supports no program binary formats. Shaders will not be cached.");
+            return formatCount > 0;
+        }();
+        return supported;
+
+    }
+
+    uint64_t ShaderCache::computeKey(const std::unordered_map<GLenum, std::string>& shaderSources) {
+        GEOGL_PROFILE_FUNCTION();
+
+        uint64_t hash = 14695981039346656037ull;
+        hashBytes(hash, &s_EntryVersion, sizeof(s_EntryVersion));
+        hashString(hash, (const char*) glGetString(GL_VENDOR));
+        hashString(hash, (const char*) glGetString(GL_RENDERER));
+        hashString(hash, (const char*) glGetString(GL_VERSION));
+
+        /* The map has no stable order, so hash the stages by type */
+        std::vector<GLenum> types;
+        types.reserve(shaderSources.size());
+        for(auto& kv : shaderSources)
+            types.push_back(kv.first);
+        std::sort(types.begin(), types.end());
+
+        for(GLenum type : types){
+            hashBytes(hash, &type, sizeof(type));
+            hashString(hash, shaderSources.at(type).c_str());
+        }
+
+        return hash;
+
+    }
+
+    bool ShaderCache::load(GLuint program, uint64_t key, bool& rejected) {
+        GEOGL_PROFILE_FUNCTION();
+
+        rejected = false;
+
+        std::ifstream in(getEntryPath(key), std::ios::in | std::ios::binary);
+        if(!in)
+            return false;
+
+        EntryHeader header{};
+        in.read((char*) &header, sizeof(header));
+        if(!in || header.magic != s_EntryMagic || header.version != s_EntryVersion || header.key != key){
+            rejected = true;
+            return false;
+        }
+
+        std::vector<char> binary(header.binaryLength);
+        in.read(binary.data(), (std::streamsize) binary.size());
+        if(!in){
+            rejected = true;
+            return false;
+        }
+
+        glProgramBinary(program, header.binaryFormat, binary.data(), (GLsizei) binary.size());
+
+        GLint isLinked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+        rejected = isLinked == GL_FALSE;
+        return !rejected;
+
+    }
+
+    bool ShaderCache::store(GLuint program, uint64_t key) {
+        GEOGL_PROFILE_FUNCTION();
+
+        GLint binaryLength = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+        if(binaryLength <= 0)
+            return false;
+
+        EntryHeader header{s_EntryMagic, s_EntryVersion, key, 0, 0};
+        std::vector<char> binary(binaryLength);
+        GLsizei writtenLength = 0;
+        glGetProgramBinary(program, binaryLength, &writtenLength, &header.binaryFormat, binary.data());
+        header.binaryLength = (uint32_t) writtenLength;
+
+        std::error_code error;
+        std::filesystem::create_directories(Shader::getCacheDirectory(), error);
+
+        /* Write beside the entry and move it in place, so another instance never reads half an entry */
+        std::string entryPath = getEntryPath(key);
+        std::string temporaryPath = GEOGL_FORMAT("{}.{}.tmp", entryPath, std::hash<std::thread::id>()(std::this_thread::get_id()));
+        {
+            std::ofstream out(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+            if(!out){
+                GEOGL_CORE_WARN_NOSTRIP("Unable to write to the shader cache at {}", temporaryPath);
+                return false;
+            }
+            out.write((const char*) &header, sizeof(header));
+            out.write(binary.data(), writtenLength);
+            if(!out){
+                out.close();
+                std::filesystem::remove(temporaryPath, error);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, entryPath, error);
+        if(error){
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+
+        return true;
+
+    }
+
+    std::string ShaderCache::getEntryPath(uint64_t key) {
+
+        return GEOGL_FORMAT("{}/{:016x}.bin", Shader::getCacheDirectory(), key);
+
+    }
+
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_OPENGLSHADERCACHE_HPP
+#define GEOGL_OPENGLSHADERCACHE_HPP
+
+#include <glad/glad.h>
+
+namespace GEOGL::Platform::OpenGL{
+
+    /**
+     * \brief Stores linked programs on disk with glGetProgramBinary, so they can be loaded with glProgramBinary
+     * instead of being compiled again.
+     *
+     * Entries are keyed by a hash of the preprocessed sources and the vendor, renderer and version of the driver, so
+     * a new driver or a changed shader misses the cache instead of loading a stale binary. Drivers may still reject a
+     * binary they wrote, in which case the shader is compiled from source and the entry rewritten.
+     * \note Every method must be called on the thread that owns the context.
+     */
+    class ShaderCache{
+    public:
+        /**
+         * \brief Checks whether the driver supports any program binary format.
+         */
+        static bool isSupported();
+
+        /**
+         * \brief Hashes the sources of a program together with the driver identification.
+         */
+        static uint64_t computeKey(const std::unordered_map<GLenum, std::string>& shaderSources);
+
+        /**
+         * \brief Loads the program binary stored under key into program, and checks that it links.
+         * @param rejected Set if an entry existed, but the driver refused it
+         * @return Whether program is linked and ready for use
+         */
+        static bool load(GLuint program, uint64_t key, bool& rejected);
+
+        /**
+         * \brief Writes the binary of a linked program to the cache under key.
+         * \note The program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+         * @return Whether the entry was written
+         */
+        static bool store(GLuint program, uint64_t key);
+
+    private:
+        static std::string getEntryPath(uint64_t key);
+
+    };
+
+}
+
+#endif //GEOGL_OPENGLSHADERCACHE_HPP
@@ -0,0 +1,331 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include "OpenGLStateCache.hpp"
+
+namespace GEOGL::Platform::OpenGL{
+
+    /* No object is ever given this name, so a binding set to it is always changed the next time it is set */
+    static const GLuint s_Unknown = 0xFFFFFFFF;
+
+    /* The generic buffer binding points that are filtered */
+    enum BufferTarget{
+        ARRAY_BUFFER,
+        UNIFORM_BUFFER,
+        SHADER_STORAGE_BUFFER,
+        PIXEL_UNPACK_BUFFER,
+        COPY_READ_BUFFER,
+        COPY_WRITE_BUFFER,
+        BUFFER_TARGET_COUNT
+    };
+
+    enum Capability{
+        BLEND,
+        DEPTH_TEST,
+        CULL_FACE,
+        SCISSOR_TEST,
+        CAPABILITY_COUNT
+    };
+
+    struct IndexedBufferBinding{
+        GLuint buffer = s_Unknown;
+        GLintptr offset = 0;
+        GLsizeiptr size = 0;
+
+        bool operator==(const IndexedBufferBinding& other) const { return buffer == other.buffer && offset == other.offset && size == other.size; };
+    };
+
+    /* Default constructed, every piece of state is unknown */
+    struct ContextState{
+        GLuint program = s_Unknown;
+        GLuint vertexArray = s_Unknown;
+        GLuint framebuffer = s_Unknown;
+        GLuint buffers[BUFFER_TARGET_COUNT] = {s_Unknown, s_Unknown, s_Unknown, s_Unknown, s_Unknown, s_Unknown};
+        std::vector<IndexedBufferBinding> uniformBuffers;
+        std::vector<IndexedBufferBinding> storageBuffers;
+        std::vector<GLuint> textureUnits;
+
+        glm::ivec4 viewport{-1};
+        int8_t capabilities[CAPABILITY_COUNT] = {-1, -1, -1, -1};
+        std::pair<GLenum, GLenum> blendFactors{s_Unknown, s_Unknown};
+        GLenum polygonMode = s_Unknown;
+        glm::vec4 clearColor{-1.0f};
+    };
+
+    static ContextState s_State;
+
+    /* Read from any thread by the debug layers, so they are atomic, even though only the context thread writes them */
+    static std::atomic<uint64_t> s_Issued{0};
+    static std::atomic<uint64_t> s_Skipped{0};
+
+    /**
+     * \brief Records a state change, counting whether it was issued or skipped.
+     * @return Whether the state changed, and the GL call has to be made.
+     */
+    template<typename T>
+    static bool change(T& current, const T& value){
+
+        if(current == value){
+            s_Skipped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        current = value;
+        s_Issued.fetch_add(1, std::memory_order_relaxed);
+        return true;
+
+    }
+
+    static int getBufferTargetIndex(GLenum target){
+
+        switch(target){
+            case GL_ARRAY_BUFFER: return ARRAY_BUFFER;
+            case GL_UNIFORM_BUFFER: return UNIFORM_BUFFER;
+            case GL_SHADER_STORAGE_BUFFER: return SHADER_STORAGE_BUFFER;
+            case GL_PIXEL_UNPACK_BUFFER: return PIXEL_UNPACK_BUFFER;
+            case GL_COPY_READ_BUFFER: return COPY_READ_BUFFER;
+            case GL_COPY_WRITE_BUFFER: return COPY_WRITE_BUFFER;
+            default: return -1;
+        }
+
+    }
+
+    static IndexedBufferBinding* getIndexedBinding(GLenum target, GLuint index){
+
+        std::vector<IndexedBufferBinding>* bindings;
+        switch(target){
+            case GL_UNIFORM_BUFFER: bindings = &s_State.uniformBuffers; break;
+            case GL_SHADER_STORAGE_BUFFER: bindings = &s_State.storageBuffers; break;
+            default: return nullptr;
+        }
+
+        if(index >= bindings->size())
+            bindings->resize(index + 1);
+        return &(*bindings)[index];
+
+    }
+
+    static int getCapabilityIndex(GLenum capability){
+
+        switch(capability){
+            case GL_BLEND: return BLEND;
+            case GL_DEPTH_TEST: return DEPTH_TEST;
+            case GL_CULL_FACE: return CULL_FACE;
+            case GL_SCISSOR_TEST: return SCISSOR_TEST;
+            default: return -1;
+        }
+
+    }
+
+    /* Binding points that are not filtered are still counted, so the statistics cover every change */
+    static bool changeUnfiltered(){
+
+        s_Issued.fetch_add(1, std::memory_order_relaxed);
+        return true;
+
+    }
+
+    void StateCache::useProgram(GLuint program) {
+
+        if(change(s_State.program, program))
+            glUseProgram(program);
+
+    }
+
+    void StateCache::bindVertexArray(GLuint vertexArray) {
+
+        if(change(s_State.vertexArray, vertexArray))
+            glBindVertexArray(vertexArray);
+
+    }
+
+    void StateCache::bindBuffer(GLenum target, GLuint buffer) {
+
+        int targetIndex = getBufferTargetIndex(target);
+        if(targetIndex < 0 ? changeUnfiltered() : change(s_State.buffers[targetIndex], buffer))
+            glBindBuffer(target, buffer);
+
+    }
+
+    void StateCache::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+
+        /* A size of -1 tells a binding of the whole buffer apart from a range */
+        IndexedBufferBinding* binding = getIndexedBinding(target, index);
+        if(binding ? !change(*binding, {buffer, 0, -1}) : !changeUnfiltered())
+            return;
+
+        glBindBufferBase(target, index, buffer);
+
+        /* Binding an index binds the generic binding point as well */
+        int targetIndex = getBufferTargetIndex(target);
+        if(targetIndex >= 0)
+            s_State.buffers[targetIndex] = buffer;
+
+    }
+
+    void StateCache::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+
+        IndexedBufferBinding* binding = getIndexedBinding(target, index);
+        if(binding ? !change(*binding, {buffer, offset, size}) : !changeUnfiltered())
+            return;
+
+        glBindBufferRange(target, index, buffer, offset, size);
+
+        int targetIndex = getBufferTargetIndex(target);
+        if(targetIndex >= 0)
+            s_State.buffers[targetIndex] = buffer;
+
+    }
+
+    void StateCache::bindTextureUnit(GLuint unit, GLuint texture) {
+
+        if(unit >= s_State.textureUnits.size())
+            s_State.textureUnits.resize(unit + 1, s_Unknown);
+
+        if(change(s_State.textureUnits[unit], texture))
+            glBindTextureUnit(unit, texture);
+
+    }
+
+    void StateCache::bindFramebuffer(GLuint framebuffer) {
+
+        if(change(s_State.framebuffer, framebuffer))
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+    }
+
+    void StateCache::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+
+        if(change(s_State.viewport, glm::ivec4(x, y, width, height)))
+            glViewport(x, y, width, height);
+
+    }
+
+    void StateCache::setEnabled(GLenum capability, bool enabled) {
+
+        int capabilityIndex = getCapabilityIndex(capability);
+        if(capabilityIndex < 0 ? !changeUnfiltered() : !change(s_State.capabilities[capabilityIndex], (int8_t) enabled))
+            return;
+
+        if(enabled)
+            glEnable(capability);
+        else
+            glDisable(capability);
+
+    }
+
+    void StateCache::blendFunc(GLenum sourceFactor, GLenum destinationFactor) {
+
+        if(change(s_State.blendFactors, std::make_pair(sourceFactor, destinationFactor)))
+            glBlendFunc(sourceFactor, destinationFactor);
+
+    }
+
+    void StateCache::polygonMode(GLenum mode) {
+
+        if(change(s_State.polygonMode, mode))
+            glPolygonMode(GL_FRONT_AND_BACK, mode);
+
+    }
+
+    void StateCache::clearColor(const glm::vec4& color) {
+
+        if(change(s_State.clearColor, color))
+            glClearColor(color.r, color.g, color.b, color.a);
+
+    }
+
+    void StateCache::deleteProgram(GLuint program) {
+
+        /* A program in use is only flagged for deletion, and stays in use. Forget it, so a reused name is bound */
+        glDeleteProgram(program);
+        if(s_State.program == program)
+            s_State.program = s_Unknown;
+
+    }
+
+    void StateCache::deleteVertexArray(GLuint vertexArray) {
+
+        glDeleteVertexArrays(1, &vertexArray);
+        if(s_State.vertexArray == vertexArray)
+            s_State.vertexArray = 0;
+
+    }
+
+    void StateCache::deleteBuffer(GLuint buffer) {
+
+        glDeleteBuffers(1, &buffer);
+        for(GLuint& binding : s_State.buffers){
+            if(binding == buffer)
+                binding = 0;
+        }
+
+        /* Whether indexed bindings are reset differs between drivers, so they are forgotten instead */
+        for(auto* bindings : {&s_State.uniformBuffers, &s_State.storageBuffers}){
+            for(IndexedBufferBinding& binding : *bindings){
+                if(binding.buffer == buffer)
+                    binding = {};
+            }
+        }
+
+    }
+
+    void StateCache::deleteTexture(GLuint texture) {
+
+        glDeleteTextures(1, &texture);
+        for(GLuint& unit : s_State.textureUnits){
+            if(unit == texture)
+                unit = 0;
+        }
+
+    }
+
+    void StateCache::deleteFramebuffer(GLuint framebuffer) {
+
+        glDeleteFramebuffers(1, &framebuffer);
+        if(s_State.framebuffer == framebuffer)
+            s_State.framebuffer = 0;
+
+    }
+
+    void StateCache::invalidate() {
+
+        s_State = ContextState();
+
+    }
+
+    StateChangeStatistics StateCache::getStatistics() {
+
+        return {s_Issued.load(std::memory_order_relaxed), s_Skipped.load(std::memory_order_relaxed)};
+
+    }
+
+    void StateCache::resetStatistics() {
+
+        s_Issued.store(0, std::memory_order_relaxed);
+        s_Skipped.store(0, std::memory_order_relaxed);
+
+    }
+
+}
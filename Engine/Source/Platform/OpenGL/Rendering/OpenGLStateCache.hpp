@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_OPENGLSTATECACHE_HPP
+#define GEOGL_OPENGLSTATECACHE_HPP
+
+#include <glad/glad.h>
+#include "../../../GEOGL/Rendering/RendererAPI.hpp"
+
+namespace GEOGL::Platform::OpenGL{
+
+    /**
+     * \brief Mirrors the OpenGL state the engine sets, so setting state that is already set never reaches the driver.
+     *
+     * Every OpenGL class binds, enables and deletes through here instead of calling OpenGL directly. State starts out
+     * unknown, so the first change of each is always issued. The element array buffer belongs to the bound vertex
+     * array, so it is never filtered. Code outside of the engine that changes this state without restoring it must call
+     * invalidate afterwards.
+     * \note Every method must be called where the GL calls run, which is the render thread when it is enabled.
+     */
+    class GEOGL_API StateCache{
+    public:
+        static void useProgram(GLuint program);
+        static void bindVertexArray(GLuint vertexArray);
+        static void bindBuffer(GLenum target, GLuint buffer);
+        static void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+        static void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+        static void bindTextureUnit(GLuint unit, GLuint texture);
+        static void bindFramebuffer(GLuint framebuffer);
+
+        static void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+        static void setEnabled(GLenum capability, bool enabled);
+        static void blendFunc(GLenum sourceFactor, GLenum destinationFactor);
+        static void polygonMode(GLenum mode);
+        static void clearColor(const glm::vec4& color);
+
+        /**
+         * \brief Deletes an object, forgetting it wherever it was bound, as OpenGL unbinds it.
+         */
+        static void deleteProgram(GLuint program);
+        static void deleteVertexArray(GLuint vertexArray);
+        static void deleteBuffer(GLuint buffer);
+        static void deleteTexture(GLuint texture);
+        static void deleteFramebuffer(GLuint framebuffer);
+
+        /**
+         * \brief Forgets all of the state, so the next change of each is issued whatever it was.
+         */
+        static void invalidate();
+
+        /**
+         * \brief Gets the number of state changes issued and skipped. Safe to call from any thread.
+         */
+        static StateChangeStatistics getStatistics();
+        static void resetStatistics();
+
+    };
+
+}
+
+#endif //GEOGL_OPENGLSTATECACHE_HPP
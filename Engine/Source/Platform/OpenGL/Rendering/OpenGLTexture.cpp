@@ -24,6 +24,8 @@
 
 
 #include "OpenGLTexture.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
 #include <STB/stb_image.h>
 #include <utility>
 #include <glad/glad.h>
@@ -37,20 +39,22 @@ namespace GEOGL::Platform::OpenGL {
         m_InternalFormat = GL_RGBA8;
         m_Format= GL_RGBA;
 
-        {
-            GEOGL_PROFILE_SCOPE("Create Texture and set Format, width, and height");
-            glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-            glTextureStorage2D(m_RendererID, 1, m_InternalFormat, (GLsizei) m_Width, (GLsizei) m_Height);
-        }
+        RenderThread::execute([&](){
+            {
+                GEOGL_PROFILE_SCOPE("Create Texture and set Format, width, and height");
+                glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+                glTextureStorage2D(m_RendererID, 1, m_InternalFormat, (GLsizei) m_Width, (GLsizei) m_Height);
+            }
 
-        {
-            GEOGL_PROFILE_SCOPE("Set Texture parameters");
-            glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            {
+                GEOGL_PROFILE_SCOPE("Set Texture parameters");
+                glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-            glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        }
+                glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+                glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            }
+        });
 
     }
 
@@ -87,31 +91,34 @@ namespace GEOGL::Platform::OpenGL {
                 break;
         }
 
-        {
-            GEOGL_PROFILE_SCOPE("Create Texture and set Format, width, and height");
-            glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-            glTextureStorage2D(m_RendererID, 1, m_InternalFormat, (GLsizei) m_Width, (GLsizei) m_Height);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Set Texture parameters");
-            glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-            glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Substitute Texture into GPU Memory");
-            glTextureSubImage2D(m_RendererID, 0, 0, 0, (GLsizei) m_Width, (GLsizei) m_Height, m_Format,
-                                GL_UNSIGNED_BYTE, (void *) data);
-        }
-
-        {
-            GEOGL_PROFILE_SCOPE("Generate MipMaps");
-            glGenerateTextureMipmap(m_RendererID);
-        }
+        /* The image is decoded on the calling thread, and only the upload runs on the render thread */
+        RenderThread::execute([&](){
+            {
+                GEOGL_PROFILE_SCOPE("Create Texture and set Format, width, and height");
+                glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+                glTextureStorage2D(m_RendererID, 1, m_InternalFormat, (GLsizei) m_Width, (GLsizei) m_Height);
+            }
+
+            {
+                GEOGL_PROFILE_SCOPE("Set Texture parameters");
+                glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+                glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+                glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            }
+
+            {
+                GEOGL_PROFILE_SCOPE("Substitute Texture into GPU Memory");
+                glTextureSubImage2D(m_RendererID, 0, 0, 0, (GLsizei) m_Width, (GLsizei) m_Height, m_Format,
+                                    GL_UNSIGNED_BYTE, (void *) data);
+            }
+
+            {
+                GEOGL_PROFILE_SCOPE("Generate MipMaps");
+                glGenerateTextureMipmap(m_RendererID);
+            }
+        });
 
         {
             GEOGL_PROFILE_SCOPE("Free the image from memory");
@@ -123,7 +130,9 @@ namespace GEOGL::Platform::OpenGL {
     Texture2D::~Texture2D() {
         GEOGL_PROFILE_FUNCTION();
 
-        glDeleteTextures(1, &m_RendererID);
+        RenderThread::submit([rendererID = m_RendererID](){
+            StateCache::deleteTexture(rendererID);
+        });
 
     }
 
@@ -132,13 +141,35 @@ namespace GEOGL::Platform::OpenGL {
 
         uint32_t bpp = m_Format == GL_RGBA ? 4 : 3;
         GEOGL_CORE_ASSERT(size == m_Width * m_Height * bpp, "The size of the data must be the entire texture.");
-        glTextureSubImage2D(m_RendererID, 0, 0, 0, (GLsizei) m_Width, (GLsizei) m_Height, m_Format, GL_UNSIGNED_BYTE, (void*) data);
+        markContentChanged();
 
+        const void* stagedData = RenderThread::stage(data, size);
+        RenderThread::submit([rendererID = m_RendererID, width = m_Width, height = m_Height, format = m_Format, stagedData](){
+            glTextureSubImage2D(rendererID, 0, 0, 0, (GLsizei) width, (GLsizei) height, format, GL_UNSIGNED_BYTE, stagedData);
 
-        {
-            GEOGL_RENDERER_PROFILE_SCOPE("Generate MipMaps");
-            glGenerateTextureMipmap(m_RendererID);
-        }
+            {
+                GEOGL_RENDERER_PROFILE_SCOPE("Generate MipMaps");
+                glGenerateTextureMipmap(rendererID);
+            }
+        });
+
+    }
+
+    void Texture2D::setSubData(void *data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        GEOGL_CORE_ASSERT(x + width <= m_Width && y + height <= m_Height, "The region must be inside of the texture.");
+        markContentChanged();
+
+        /* Rows are read with the default unpack alignment of 4 bytes */
+        uint32_t bpp = m_Format == GL_RGBA ? 4 : 3;
+        uint32_t rowSize = (width * bpp + 3) & ~3u;
+        const void* stagedData = RenderThread::stage(data, height ? rowSize * (height - 1) + width * bpp : 0);
+
+        /* The texture only has one level, so there are no mipmaps to regenerate after each region */
+        RenderThread::submit([rendererID = m_RendererID, x, y, width, height, format = m_Format, stagedData](){
+            glTextureSubImage2D(rendererID, 0, (GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height, format, GL_UNSIGNED_BYTE, stagedData);
+        });
 
     }
 
@@ -147,7 +178,9 @@ namespace GEOGL::Platform::OpenGL {
         //GEOGL_CORE_INFO("Binding texture {} to slot {}", m_RendererID, slotID);
 
         //glBindTexture(GL_TEXTURE0+slotID, m_RendererID);
-        glBindTextureUnit(slotID, m_RendererID);
+        RenderThread::submit([rendererID = m_RendererID, slotID](){
+            StateCache::bindTextureUnit(slotID, rendererID);
+        });
         //glBindTextures(GL_TEXTURE0+slotID, 1, &m_RendererID);
         //glActiveTexture(GL_TEXTURE0+slotID);
         //glBindTexture(GL_TEXTURE_2D, m_RendererID);
@@ -38,8 +38,10 @@ namespace GEOGL::Platform::OpenGL{
         [[nodiscard]] inline uint32_t getWidth() const override { return m_Width; };
         [[nodiscard]] inline uint32_t getHeight() const override { return m_Height; };
         [[nodiscard]] inline uint32_t getRendererID() const override { return m_RendererID; };
+        [[nodiscard]] inline uint32_t getInternalFormat() const { return m_InternalFormat; };
 
         void setData(void* data, uint32_t size) override;
+        void setSubData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
         /**
          * Binds the texture for rendering
@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "OpenGLTextureTable.hpp"
+#include "OpenGLTexture.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderCommand.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
+
+namespace GEOGL::Platform::OpenGL{
+
+    /*
+     * Texture Arrays
+     */
+
+    TextureArrayTable::TextureArrayTable(uint32_t textureUnits) : m_TextureUnits(textureUnits){
+        GEOGL_PROFILE_FUNCTION();
+
+        /* Arrays are allocated whole, so keep them small enough that a few odd sized textures do not waste much */
+        m_LayersPerArray = std::min<uint32_t>({RenderCommand::getCapabilities().maxArrayTextureLayers, 64, 1u << s_LayerBits});
+
+    }
+
+    TextureArrayTable::~TextureArrayTable() {
+        GEOGL_PROFILE_FUNCTION();
+
+        for(auto& array : m_Arrays){
+            RenderThread::submit([rendererID = array.rendererID](){
+                StateCache::deleteTexture(rendererID);
+            });
+        }
+
+    }
+
+    void TextureArrayTable::place(const GEOGL::Texture2D& texture, Placement& placement) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        const auto& openGLTexture = static_cast<const Texture2D&>(texture);
+        uint32_t width = openGLTexture.getWidth();
+        uint32_t height = openGLTexture.getHeight();
+        uint32_t internalFormat = openGLTexture.getInternalFormat();
+
+        /* Reuse a layer whose texture has been destroyed, or failing that, allocate a new array */
+        bool placed = false;
+        for(uint32_t arrayIndex = 0; arrayIndex < m_Arrays.size() && !placed; ++arrayIndex){
+            TextureArray& array = m_Arrays[arrayIndex];
+            if(array.width != width || array.height != height || array.internalFormat != internalFormat)
+                continue;
+
+            for(uint32_t layer = 0; layer < array.layers.size(); ++layer){
+                if(!array.layers[layer].isValid() || !GEOGL::Texture2D::resolve(array.layers[layer])){
+                    placement.array = arrayIndex;
+                    placement.layer = layer;
+                    placed = true;
+                    break;
+                }
+            }
+        }
+
+        if(!placed){
+            TextureArray array;
+            array.width = width;
+            array.height = height;
+            array.internalFormat = internalFormat;
+            array.layers.resize(m_LayersPerArray);
+
+            RenderThread::execute([&](){
+                glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &array.rendererID);
+                glTextureStorage3D(array.rendererID, 1, internalFormat, (GLsizei) width, (GLsizei) height, (GLsizei) m_LayersPerArray);
+
+                glTextureParameteri(array.rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glTextureParameteri(array.rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                glTextureParameteri(array.rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+                glTextureParameteri(array.rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            });
+
+            placement.array = (uint32_t) m_Arrays.size();
+            placement.layer = 0;
+            m_Arrays.push_back(std::move(array));
+        }
+
+        m_Arrays[placement.array].layers[placement.layer] = texture.getHandle();
+        placement.generation = texture.getHandle().generation;
+
+    }
+
+    int32_t TextureArrayTable::add(const Ref<GEOGL::Texture2D>& texture) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        TextureHandle handle = texture->getHandle();
+
+        /* Copy the texture into a layer the first time it is drawn, and again whenever its contents change */
+        Placement& placement = m_Placements[handle.rendererID];
+        bool copy = false;
+        if(placement.generation != handle.generation){
+            place(*texture, placement);
+            copy = true;
+        }else{
+            copy = placement.contentVersion != texture->getContentVersion();
+        }
+
+        TextureArray& array = m_Arrays[placement.array];
+        if(copy){
+            RenderThread::submit([source = handle.rendererID, destination = array.rendererID, layer = placement.layer, width = array.width, height = array.height](){
+                glCopyImageSubData(source, GL_TEXTURE_2D, 0, 0, 0, 0,
+                                   destination, GL_TEXTURE_2D_ARRAY, 0, 0, 0, (GLint) layer,
+                                   (GLsizei) width, (GLsizei) height, 1);
+            });
+            placement.contentVersion = texture->getContentVersion();
+        }
+
+        if(array.batchStamp != m_BatchStamp){
+            if(m_BatchArrays.size() >= m_TextureUnits)
+                return -1;
+
+            array.batchStamp = m_BatchStamp;
+            array.unit = (uint32_t) m_BatchArrays.size();
+            m_BatchArrays.push_back(placement.array);
+        }
+
+        return (int32_t) ((array.unit << s_LayerBits) | placement.layer);
+
+    }
+
+    void TextureArrayTable::bind() {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        for(uint32_t unit = 0; unit < m_BatchArrays.size(); ++unit){
+            RenderThread::submit([unit, rendererID = m_Arrays[m_BatchArrays[unit]].rendererID](){
+                StateCache::bindTextureUnit(unit, rendererID);
+            });
+        }
+
+    }
+
+    void TextureArrayTable::reset() {
+
+        m_BatchArrays.clear();
+
+        /* Bumping the stamp unbinds every array at once. Clear them on the rare wrap around */
+        if(++m_BatchStamp == 0){
+            for(auto& array : m_Arrays)
+                array.batchStamp = 0;
+            m_BatchStamp = 1;
+        }
+
+    }
+
+    void TextureArrayTable::setUpShader(const Ref<GEOGL::Shader>& shader) {
+
+        std::vector<int32_t> samplers(m_TextureUnits);
+        for(uint32_t i = 0; i < m_TextureUnits; ++i){
+            samplers[i] = (int32_t)i;
+        }
+        shader->setIntArray("u_TextureArrays", samplers.data(), m_TextureUnits);
+
+    }
+
+    std::string TextureArrayTable::getShaderDeclarations() const {
+
+        return GEOGL_FORMAT("uniform sampler2DArray u_TextureArrays[{}];", m_TextureUnits);
+
+    }
+
+    std::string TextureArrayTable::getShaderSampleCode() const {
+
+        std::string result = GEOGL_FORMAT("    int textureIndex = int(v_TextureIndex);\n"
+                                          "    vec3 textureCoord = vec3(v_TextureCoord * v_TilingFactor, float(textureIndex & {}));\n"
+                                          "    switch(textureIndex >> {})\n"
+                                          "    {{\n", (1u << s_LayerBits) - 1, s_LayerBits);
+
+        for(uint32_t i = 0; i < m_TextureUnits; ++i){
+            result += GEOGL_FORMAT("        case {0}: texColor *= texture(u_TextureArrays[{0}], textureCoord); break;\n", i);
+        }
+        result += "    }";
+
+        return result;
+
+    }
+
+    /*
+     * Bindless
+     */
+
+    /* ARB_bindless_texture is not part of the core profile GLAD loads, so its entry points are loaded here */
+    using GetTextureHandleFunction = GLuint64 (APIENTRY *)(GLuint texture);
+    using MakeTextureHandleResidentFunction = void (APIENTRY *)(GLuint64 handle);
+
+    static GetTextureHandleFunction s_GetTextureHandle = nullptr;
+    static MakeTextureHandleResidentFunction s_MakeTextureHandleResident = nullptr;
+    static MakeTextureHandleResidentFunction s_MakeTextureHandleNonResident = nullptr;
+
+    BindlessTextureTable::BindlessTextureTable() {
+        GEOGL_PROFILE_FUNCTION();
+
+        if(!s_GetTextureHandle){
+            s_GetTextureHandle = (GetTextureHandleFunction) glfwGetProcAddress("glGetTextureHandleARB");
+            s_MakeTextureHandleResident = (MakeTextureHandleResidentFunction) glfwGetProcAddress("glMakeTextureHandleResidentARB");
+            s_MakeTextureHandleNonResident = (MakeTextureHandleResidentFunction) glfwGetProcAddress("glMakeTextureHandleNonResidentARB");
+        }
+        GEOGL_CORE_ASSERT(s_GetTextureHandle && s_MakeTextureHandleResident && s_MakeTextureHandleNonResident, "Failed to load ARB_bindless_texture.");
+
+        RenderThread::execute([&](){
+            glCreateBuffers(1, &m_StorageBufferID);
+        });
+        m_BatchHandles.reserve(s_Capacity);
+
+    }
+
+    BindlessTextureTable::~BindlessTextureTable() {
+        GEOGL_PROFILE_FUNCTION();
+
+        /* The handles of destroyed textures went with them, so only the live ones are still resident */
+        std::vector<uint64_t> residentHandles;
+        for(auto& [rendererID, residentHandle] : m_ResidentHandles){
+            if(GEOGL::Texture2D::resolve({rendererID, residentHandle.generation}))
+                residentHandles.push_back(residentHandle.handle);
+        }
+
+        RenderThread::submit([storageBufferID = m_StorageBufferID, residentHandles = std::move(residentHandles)](){
+            for(uint64_t handle : residentHandles){
+                s_MakeTextureHandleNonResident(handle);
+            }
+
+            StateCache::deleteBuffer(storageBufferID);
+        });
+
+    }
+
+    int32_t BindlessTextureTable::add(const Ref<GEOGL::Texture2D>& texture) {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        if(m_BatchHandles.size() >= s_Capacity)
+            return -1;
+
+        TextureHandle handle = texture->getHandle();
+        ResidentHandle& residentHandle = m_ResidentHandles[handle.rendererID];
+        if(residentHandle.generation != handle.generation){
+            residentHandle.generation = handle.generation;
+            RenderThread::execute([&](){
+                residentHandle.handle = s_GetTextureHandle(handle.rendererID);
+                s_MakeTextureHandleResident(residentHandle.handle);
+            });
+        }
+
+        m_BatchHandles.push_back(residentHandle.handle);
+        return (int32_t) m_BatchHandles.size() - 1;
+
+    }
+
+    void BindlessTextureTable::bind() {
+        GEOGL_RENDERER_PROFILE_FUNCTION();
+
+        /* Orphan the buffer every batch, so the upload never waits on a draw still reading the last batch */
+        size_t size = m_BatchHandles.size() * sizeof(uint64_t);
+        const void* stagedHandles = RenderThread::stage(m_BatchHandles.data(), size);
+        RenderThread::submit([storageBufferID = m_StorageBufferID, stagedHandles, size](){
+            glNamedBufferData(storageBufferID, (GLsizeiptr) size, stagedHandles, GL_STREAM_DRAW);
+            StateCache::bindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, storageBufferID);
+        });
+
+    }
+
+    void BindlessTextureTable::reset() {
+
+        m_BatchHandles.clear();
+
+    }
+
+    std::string BindlessTextureTable::getShaderExtensions() const {
+
+        return "#extension GL_ARB_bindless_texture : require";
+
+    }
+
+    std::string BindlessTextureTable::getShaderDeclarations() const {
+
+        return "layout(std430, binding = 0) readonly buffer TextureHandles{\n"
+               "    uvec2 u_TextureHandles[];\n"
+               "};";
+
+    }
+
+    std::string BindlessTextureTable::getShaderSampleCode() const {
+
+        return "    texColor *= texture(sampler2D(u_TextureHandles[int(v_TextureIndex)]), v_TextureCoord * v_TilingFactor);";
+
+    }
+
+}
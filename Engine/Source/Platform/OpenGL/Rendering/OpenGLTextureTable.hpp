@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_OPENGLTEXTURETABLE_HPP
+#define GEOGL_OPENGLTEXTURETABLE_HPP
+
+#include "../../../GEOGL/Rendering/TextureTable.hpp"
+
+namespace GEOGL::Platform::OpenGL{
+
+    /**
+     * \brief A TextureTable that copies textures into the layers of GL_TEXTURE_2D_ARRAYs, one set of arrays for every
+     * size and format. The index of a texture is its unit shifted left by layerBits, plus its layer.
+     */
+    class GEOGL_API TextureArrayTable : public GEOGL::TextureTable{
+    public:
+        explicit TextureArrayTable(uint32_t textureUnits);
+        ~TextureArrayTable() override;
+
+        int32_t add(const Ref<GEOGL::Texture2D>& texture) override;
+        void bind() override;
+        void reset() override;
+        void setUpShader(const Ref<GEOGL::Shader>& shader) override;
+
+        [[nodiscard]] std::string getShaderVersion() const override { return "330 core"; };
+        [[nodiscard]] std::string getShaderExtensions() const override { return ""; };
+        [[nodiscard]] std::string getShaderDeclarations() const override;
+        [[nodiscard]] std::string getShaderSampleCode() const override;
+
+    private:
+        struct TextureArray{
+            uint32_t rendererID = 0;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t internalFormat = 0;
+
+            /* The texture in each layer. A layer is free once its texture has been destroyed */
+            std::vector<TextureHandle> layers;
+
+            /* The unit the array is bound to, only valid while batchStamp matches the current batch */
+            uint32_t batchStamp = 0;
+            uint32_t unit = 0;
+        };
+
+        /**
+         * \brief Where a texture was copied to, and which version of its contents was copied.
+         */
+        struct Placement{
+            uint32_t generation = 0;
+            uint32_t array = 0;
+            uint32_t layer = 0;
+            uint32_t contentVersion = 0;
+        };
+
+        void place(const GEOGL::Texture2D& texture, Placement& placement);
+
+    private:
+        static constexpr uint32_t s_LayerBits = 11;
+
+        uint32_t m_TextureUnits;
+        uint32_t m_LayersPerArray;
+
+        std::vector<TextureArray> m_Arrays;
+        std::unordered_map<uint32_t, Placement> m_Placements;
+
+        std::vector<uint32_t> m_BatchArrays;
+        uint32_t m_BatchStamp = 1;
+    };
+
+    /**
+     * \brief A TextureTable that stores ARB_bindless_texture handles in a shader storage buffer. The index of a texture
+     * is the position of its handle in the buffer.
+     */
+    class GEOGL_API BindlessTextureTable : public GEOGL::TextureTable{
+    public:
+        BindlessTextureTable();
+        ~BindlessTextureTable() override;
+
+        int32_t add(const Ref<GEOGL::Texture2D>& texture) override;
+        void bind() override;
+        void reset() override;
+        void setUpShader(const Ref<GEOGL::Shader>& shader) override {};
+
+        [[nodiscard]] std::string getShaderVersion() const override { return "450 core"; };
+        [[nodiscard]] std::string getShaderExtensions() const override;
+        [[nodiscard]] std::string getShaderDeclarations() const override;
+        [[nodiscard]] std::string getShaderSampleCode() const override;
+
+    private:
+        struct ResidentHandle{
+            uint32_t generation = 0;
+            uint64_t handle = 0;
+        };
+
+    private:
+        static constexpr uint32_t s_Capacity = 4096;
+
+        uint32_t m_StorageBufferID = 0;
+
+        /* Handles are made resident once, and stay resident until the texture is destroyed */
+        std::unordered_map<uint32_t, ResidentHandle> m_ResidentHandles;
+        std::vector<uint64_t> m_BatchHandles;
+    };
+
+}
+
+#endif //GEOGL_OPENGLTEXTURETABLE_HPP
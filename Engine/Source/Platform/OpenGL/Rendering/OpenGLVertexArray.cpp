@@ -25,6 +25,8 @@
 #include <glad/glad.h>
 #include "OpenGLVertexArray.hpp"
 #include "OpenGLShader.hpp"
+#include "OpenGLStateCache.hpp"
+#include "../../../GEOGL/Rendering/RenderThread.hpp"
 
 namespace GEOGL::Platform::OpenGL{
 
@@ -32,8 +34,9 @@ namespace GEOGL::Platform::OpenGL{
     VertexArray::VertexArray(){
         GEOGL_PROFILE_FUNCTION();
 
-        glCreateVertexArrays(1, &m_RendererID);
-        glBindVertexArray(0);
+        RenderThread::execute([&](){
+            glCreateVertexArrays(1, &m_RendererID);
+        });
 
     }
 
@@ -41,36 +44,27 @@ namespace GEOGL::Platform::OpenGL{
         GEOGL_PROFILE_FUNCTION();
         //GEOGL_CORE_CRITICAL_NOSTRIP("Destroyed the vao #{}", m_RendererID);
 
-        /* Bind the vertex array so we no longer have the VBOs bound */
-        glBindVertexArray(m_RendererID);
-        for(const auto& vertexBuffer : m_VertexBuffers){
-            vertexBuffer->unbind();
-        }
-        m_IndexBuffer->unbind();
-        setBoundID(0);
-
-        /* now, delete the VAO */
-        glBindVertexArray(0);
-        glDeleteVertexArrays(1, &m_RendererID);
+        RenderThread::submit([rendererID = m_RendererID](){
+            StateCache::deleteVertexArray(rendererID);
+        });
 
     }
 
     void VertexArray::bind() const{
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        if(m_RendererID != getBoundID()) {
-            //GEOGL_CORE_CRITICAL_NOSTRIP("Binding the VAO #{}", m_RendererID);
-            glBindVertexArray(m_RendererID);
-            setBoundID(m_RendererID);
-        }
+        RenderThread::submit([rendererID = m_RendererID](){
+            StateCache::bindVertexArray(rendererID);
+        });
 
     }
 
     void VertexArray::unbind() const{
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        setBoundID(0);
-        glBindVertexArray(0);
+        RenderThread::submit([](){
+            StateCache::bindVertexArray(0);
+        });
 
     }
 
@@ -80,41 +74,73 @@ namespace GEOGL::Platform::OpenGL{
         GEOGL_CORE_ASSERT_NOSTRIP(!vertexBuffer->getLayout().getElements().empty(),
                                   "OpenGL Vertex Buffer elements appears to be empty. Please call setLayout() with a valid BufferLayout on your VertexBuffer before calling {}().", __func__);
 
-        glBindVertexArray(m_RendererID);
-        vertexBuffer->bind();
+        /* Each vertex buffer gets its own binding, and its attributes continue from where the previous one left off */
+        auto binding = (uint32_t) m_VertexBuffers.size();
+        uint32_t firstIndex = m_VertexAttributeIndex;
+        m_VertexAttributeIndex += (uint32_t) vertexBuffer->getLayout().getElements().size();
+
+        /* The attribute formats are described once, separately from the buffer they are read from */
+        RenderThread::submit([rendererID = m_RendererID, layout = vertexBuffer->getLayout(), bufferID = vertexBuffer->getRendererID(), binding, firstIndex](){
+            uint32_t index = firstIndex;
+            for(const BufferElement& element : layout){
+
+                glEnableVertexArrayAttrib(rendererID, index);
+
+                /* Integers that are not normalized must stay integers, which glVertexArrayAttribFormat would convert to floats */
+                if(shaderDataTypeIsInteger(element.dataType) && !element.normalized){
+                    glVertexArrayAttribIFormat(
+                            rendererID,
+                            index,
+                            element.getComponentCount(),
+                            shaderDataTypeToOpenGLBaseType(element.dataType),
+                            element.offset);
+                }else{
+                    glVertexArrayAttribFormat(
+                            rendererID,
+                            index,
+                            element.getComponentCount(),
+                            shaderDataTypeToOpenGLBaseType(element.dataType),
+                            element.normalized ? GL_TRUE : GL_FALSE,
+                            element.offset);
+                }
+                glVertexArrayAttribBinding(rendererID, index, binding);
+
+                index++;
+            }
+
+            glVertexArrayBindingDivisor(rendererID, binding, layout.getInstanceDivisor());
+            glVertexArrayVertexBuffer(rendererID, binding, bufferID, 0, (GLsizei) layout.getStride());
+        });
+
+        m_VertexBuffers.push_back(vertexBuffer);
 
-        uint32_t index = 0;
-        const auto& layout = vertexBuffer->getLayout();
-        for(const BufferElement& element : layout){
+    }
 
-            /* Hopefully this doesn't crash */
-            void* elementOffsetPtr = reinterpret_cast<void*>(element.offset);
+    void VertexArray::setVertexBuffer(uint32_t binding, const Ref<GEOGL::VertexBuffer> &vertexBuffer, uint32_t offset){
+        GEOGL_RENDERER_PROFILE_FUNCTION();
 
-            glEnableVertexAttribArray(index);
-            glVertexAttribPointer(
-                    index,
-                    element.getComponentCount(),
-                    shaderDataTypeToOpenGLBaseType(element.dataType),
-                    element.normalized ? GL_TRUE : GL_FALSE,
-                    layout.getStride(),
-                    elementOffsetPtr);
+        GEOGL_CORE_ASSERT(binding < m_VertexBuffers.size(), "Vertex array has no binding {}.", binding);
+        GEOGL_CORE_ASSERT(vertexBuffer->getLayout().getStride() == m_VertexBuffers[binding]->getLayout().getStride(),
+                          "Vertex buffer stride does not match binding {}.", binding);
 
-            index++;
-        }
+        /* Only the buffer changes, the attribute formats of the binding stay as they are */
+        RenderThread::submit([rendererID = m_RendererID, binding, bufferID = vertexBuffer->getRendererID(), offset, stride = vertexBuffer->getLayout().getStride()](){
+            glVertexArrayVertexBuffer(rendererID, binding, bufferID, offset, (GLsizei) stride);
+        });
 
-        m_VertexBuffers.push_back(vertexBuffer);
-        glBindVertexArray(0);
+        m_VertexBuffers[binding] = vertexBuffer;
 
     }
 
     void VertexArray::setIndexBuffer(const Ref<GEOGL::IndexBuffer> &indexBuffer){
         GEOGL_RENDERER_PROFILE_FUNCTION();
 
-        glBindVertexArray(m_RendererID);
-        indexBuffer->bind();
+        /* The element array buffer is part of the vertex array, so it is attached without binding either */
+        RenderThread::submit([rendererID = m_RendererID, indexBufferID = indexBuffer->getRendererID()](){
+            glVertexArrayElementBuffer(rendererID, indexBufferID);
+        });
 
         m_IndexBuffer = indexBuffer;
-        glBindVertexArray(0);
 
     }
 
@@ -39,6 +39,7 @@ namespace GEOGL::Platform::OpenGL{
         void unbind() const override;
 
         void addVertexBuffer(const Ref<GEOGL::VertexBuffer>& vertexBuffer) override;
+        void setVertexBuffer(uint32_t binding, const Ref<GEOGL::VertexBuffer>& vertexBuffer, uint32_t offset) override;
         void setIndexBuffer(const Ref<GEOGL::IndexBuffer>& indexBuffer) override;
 
         inline const std::vector<Ref<GEOGL::VertexBuffer>>& getVertexBuffers() const override{ return m_VertexBuffers; };
@@ -47,6 +48,7 @@ namespace GEOGL::Platform::OpenGL{
     private:
         uint32_t m_RendererID;
         std::vector<Ref<GEOGL::VertexBuffer>> m_VertexBuffers;
+        uint32_t m_VertexAttributeIndex = 0;
         Ref<GEOGL::IndexBuffer> m_IndexBuffer;
 
     };
@@ -50,7 +50,6 @@ namespace GEOGL::Platform::Vulkan{
         virtual void drawIndexed(const Ref<VertexArray>& vertexArray) override;
 
     private:
-        glm::vec4 m_ClearColor;
 
 
     };
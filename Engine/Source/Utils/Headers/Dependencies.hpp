@@ -39,14 +39,21 @@ using json = nlohmann::json;
 #include <string>
 #include <sstream>
 #include <vector>
+#include <array>
+#include <cstddef>
+#include <type_traits>
 #include <memory>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <chrono>
 #include <algorithm>
+#include <stdexcept>
 #include <fstream>
 #include <thread>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
 
 /* spdlog */
 #include <spdlog/spdlog.h>
@@ -23,11 +23,13 @@
  *******************************************************************************/
 
 #include "TrackMemoryAllocations.hpp"
+#include <atomic>
 
-static size_t bytesAllocated = 0;
-static size_t allocations = 0;
-static size_t bytesDeallocated = 0;
-static size_t deallocations = 0;
+/* The render thread allocates too, so the counts have to be atomic */
+static std::atomic<size_t> bytesAllocated{0};
+static std::atomic<size_t> allocations{0};
+static std::atomic<size_t> bytesDeallocated{0};
+static std::atomic<size_t> deallocations{0};
 
 size_t GEOGL::getNumberAllocations() {
     return allocations;
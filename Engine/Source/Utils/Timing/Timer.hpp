@@ -27,6 +27,9 @@ namespace GEOGL{
         void endSession();
 
         inline void writeProfile(const ProfileResult &result){
+            /* The render thread profiles too */
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
             if (m_ProfileCount++ > 0)
                 m_OutputStream << ",";
 
@@ -55,6 +58,7 @@ namespace GEOGL{
         InstrumentationSession* m_CurrentSession;
         std::ofstream m_OutputStream;
         int m_ProfileCount;
+        std::mutex m_Mutex;
     };
 
     class GEOGL_API InstrumentationTimer{
@@ -63,7 +67,7 @@ namespace GEOGL{
                 : m_Name(name), m_Stopped(false){
             m_StartTimepoint = std::chrono::high_resolution_clock::now();
             m_StartTime = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch().count();
-            static long long previousTime = 0;
+            thread_local long long previousTime = 0;
             if(m_StartTime == previousTime) {
                 m_StartTime++;
             }
@@ -0,0 +1,2 @@
+#include "Constants.glsl"
+vec4 getColor(){ return vec4(COLOR_VALUE); }
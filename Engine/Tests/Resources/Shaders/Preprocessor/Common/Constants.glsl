@@ -0,0 +1 @@
+#define COLOR_VALUE 1.0
@@ -0,0 +1,2 @@
+// B
+#include "A.glsl"
@@ -0,0 +1,2 @@
+/* The Renderer2D quad shader, loaded from a folder the way an application shader is */
+#include <GEOGL/Renderer2D/Texture.glsl>
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <cstddef>
+#include <Catch/Catch2.hpp>
+#include "../NullRenderer/NullRendererTest.hpp"
+
+struct TestVertex{
+    glm::vec3 position;
+    uint32_t color;
+    float tilingFactor;
+};
+
+TEST_CASE("Vertex layouts are derived from vertex structs at compile time", "[BufferLayout]"){
+
+    static constexpr auto layout = GEOGL::makeBufferLayout<TestVertex>(
+            GEOGL_VERTEX_ELEMENT(TestVertex, position, "a_Position"),
+            GEOGL_VERTEX_ELEMENT_AS(TestVertex, color, GEOGL::ShaderDataType::UBYTE4, "a_Color", true),
+            GEOGL_VERTEX_ELEMENT(TestVertex, tilingFactor, "a_TilingFactor"));
+
+    static_assert(layout.stride == sizeof(TestVertex));
+    static_assert(layout.elements[1].offset == offsetof(TestVertex, color) && layout.elements[1].normalized);
+    static_assert(layout.elements[2].dataType == GEOGL::ShaderDataType::FLOAT);
+
+    initNullRenderer();
+
+    auto first = GEOGL::VertexBuffer::create(sizeof(TestVertex) * 4);
+    auto second = GEOGL::VertexBuffer::create(sizeof(TestVertex) * 4);
+    first->setLayout(layout);
+    second->setLayout(layout);
+    REQUIRE(first->getLayout().getStride() == sizeof(TestVertex));
+    REQUIRE(first->getLayout().getElements()[1].name == "a_Color");
+    REQUIRE(first->getLayout().getElements()[1].getComponentCount() == 4);
+    REQUIRE(first->getRendererID() != second->getRendererID());
+
+    /* Swapping the buffer of a binding keeps the binding where it was */
+    auto vertexArray = GEOGL::VertexArray::create();
+    vertexArray->addVertexBuffer(first);
+    vertexArray->setVertexBuffer(0, second);
+    REQUIRE(vertexArray->getVertexBuffers().size() == 1);
+    REQUIRE(vertexArray->getVertexBuffers()[0] == second);
+
+}
+
+TEST_CASE("Runtime layouts own the names of their elements", "[BufferLayout]"){
+
+    GEOGL::BufferLayout layout;
+    {
+        std::string name = "a_Position";
+        layout = GEOGL::BufferLayout({{GEOGL::ShaderDataType::FLOAT3, name}, {GEOGL::ShaderDataType::FLOAT2, name + "Offset"}});
+    }
+
+    REQUIRE(layout.getElements()[0].name == "a_Position");
+    REQUIRE(layout.getElements()[1].name == "a_PositionOffset");
+    REQUIRE(layout.getElements()[1].offset == 12);
+    REQUIRE(layout.getStride() == 20);
+
+}
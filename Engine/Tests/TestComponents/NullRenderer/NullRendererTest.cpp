@@ -0,0 +1,381 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include <Catch/Catch2.hpp>
+#include "NullRendererTest.hpp"
+
+static void drawQuadGrid(uint32_t quadCount){
+
+    GEOGL::OrthographicCamera camera({-100.0f, 100.0f, -100.0f, 100.0f});
+
+    GEOGL::Renderer2D::beginScene(camera);
+    for(uint32_t i = 0; i < quadCount; ++i){
+        glm::vec3 position((float)(i % 100) * 2.0f - 99.0f, (float)(i / 100 % 100) * 2.0f - 99.0f, 0.0f);
+        GEOGL::Renderer2D::drawQuad({position, {1.0f, 1.0f}, {0.2f, 0.4f, 0.8f, 1.0f}});
+    }
+    GEOGL::Renderer2D::endScene();
+
+}
+
+/**
+ * Draws the quad grid as a scene of its own, and returns what the Null backend was asked to do for it.
+ */
+static GEOGL::Platform::Null::Recording recordQuadGrid(uint32_t quadCount){
+
+    GEOGL::Renderer2D::resetStats();
+    NullRendererAPI::resetRecording();
+
+    drawQuadGrid(quadCount);
+
+    return NullRendererAPI::getRecording();
+
+}
+
+TEST_CASE("The Null backend records every batch the Renderer2D draws", "[NullRenderer]"){
+
+    initNullRenderer();
+
+    const uint32_t quadCount = 2500;
+    GEOGL::Renderer2D::resetStats();
+    NullRendererAPI::resetRecording();
+
+    drawQuadGrid(quadCount);
+
+    const auto& recording = NullRendererAPI::getRecording();
+    const uint32_t expectedBatches = (quadCount + s_MaxQuads - 1) / s_MaxQuads;
+
+    REQUIRE(recording.drawCalls == expectedBatches);
+    REQUIRE(recording.drawCalls == GEOGL::Renderer2D::getStatistics().drawCalls);
+    REQUIRE(recording.indexCount == (uint64_t) quadCount * 6);
+    REQUIRE(recording.vertexBytes > 0);
+
+}
+
+TEST_CASE("The Null backend only records binds that change state", "[NullRenderer]"){
+
+    initNullRenderer();
+
+    auto vertexBuffer = GEOGL::VertexBuffer::create(64);
+    auto uniformBuffer = GEOGL::UniformBuffer::create(512, 3);
+    auto texture = GEOGL::Texture2D::create(1, 1);
+    auto otherTexture = GEOGL::Texture2D::create(1, 1);
+    NullRendererAPI::resetRecording();
+
+    vertexBuffer->bind();
+    vertexBuffer->bind();
+    uniformBuffer->bindRange(0, 256);
+    uniformBuffer->bindRange(0, 256);
+    uniformBuffer->bindRange(256, 256);
+    uniformBuffer->bind();
+    uniformBuffer->bind();
+    REQUIRE(NullRendererAPI::getRecording().bufferBinds == 4);
+
+    texture->bind(0);
+    texture->bind(0);
+    texture->bind(1);
+    otherTexture->bind(0);
+    REQUIRE(NullRendererAPI::getRecording().textureBinds == 3);
+
+}
+
+/**
+ * Draws textured quads of two textures interleaved with opaque flat quads, in the worst order for batching.
+ */
+static void drawInterleavedQuads(const GEOGL::Ref<GEOGL::Texture2D>& front, const GEOGL::Ref<GEOGL::Texture2D>& back, uint32_t rounds){
+
+    GEOGL::OrthographicCamera camera({-10.0f, 10.0f, -10.0f, 10.0f});
+
+    GEOGL::Renderer2D::beginScene(camera);
+    for(uint32_t i = 0; i < rounds; ++i){
+        float x = (float)i - 4.0f;
+        GEOGL::Renderer2D::drawQuad({{x, 0.0f, 0.2f}}, front);
+        GEOGL::Renderer2D::drawQuad({{x, 0.0f, 0.1f}}, back);
+        GEOGL::Renderer2D::drawQuad({{x, 1.0f, 0.5f}, {1.0f, 1.0f}, {1.0f, 0.0f, 0.0f, 1.0f}});
+    }
+    GEOGL::Renderer2D::endScene();
+
+}
+
+TEST_CASE("Deferred submission batches quads in sort key order", "[NullRenderer]"){
+
+    /* With a single texture slot every change of texture flushes, so the batches show the order quads were written in */
+    GEOGL::Renderer2D::BatchProperties properties = getNullBatchProperties();
+    properties.maxTextureSlots = 1;
+    properties.textureBinding = GEOGL::Renderer2D::TextureBinding::SLOTS;
+    NullBatchScope scope(properties);
+
+    auto front = GEOGL::Texture2D::create(1, 1);
+    auto back = GEOGL::Texture2D::create(1, 1);
+    const uint32_t rounds = 8;
+
+    SECTION("Immediate submission flushes on every change of texture"){
+        GEOGL::Renderer2D::resetStats();
+        NullRendererAPI::resetRecording();
+
+        drawInterleavedQuads(front, back, rounds);
+
+        REQUIRE(NullRendererAPI::getRecording().drawCalls == rounds * 3);
+    }
+
+    SECTION("Deferred submission draws the opaque quads, then the textures back to front"){
+        GEOGL::Renderer2D::setSubmissionMode(GEOGL::Renderer2D::SubmissionMode::DEFERRED);
+        GEOGL::Renderer2D::resetStats();
+        NullRendererAPI::resetRecording();
+
+        drawInterleavedQuads(front, back, rounds);
+
+        const auto& recording = NullRendererAPI::getRecording();
+        REQUIRE(recording.drawCalls == 3);
+        REQUIRE(GEOGL::Renderer2D::getStatistics().drawCalls == 3);
+        REQUIRE(GEOGL::Renderer2D::getStatistics().quadCount == rounds * 3);
+        REQUIRE(recording.indexCount == (uint64_t) rounds * 3 * 6);
+
+        /* The opaque batch is drawn with the color only shader, which binds no texture, so only the others are checked */
+        REQUIRE(recording.drawTextures.size() == 3);
+        REQUIRE(recording.drawTextures[1] == back->getRendererID());
+        REQUIRE(recording.drawTextures[2] == front->getRendererID());
+    }
+
+}
+
+/**
+ * Draws quads inside the view of a 20 by 20 camera, outside of it, and across its right edge, both one at a time and
+ * in bulk.
+ */
+static void drawQuadsAroundView(uint32_t insideCount, uint32_t outsideCount){
+
+    GEOGL::OrthographicCamera camera({-10.0f, 10.0f, -10.0f, 10.0f});
+
+    std::vector<GEOGL::Renderer2D::QuadInstance> outside;
+    for(uint32_t i = 0; i < outsideCount; ++i)
+        outside.emplace_back(glm::vec3(50.0f, (float)i, 0.0f));
+
+    GEOGL::Renderer2D::beginScene(camera);
+    for(uint32_t i = 0; i < insideCount; ++i)
+        GEOGL::Renderer2D::drawQuad({{(float)i - 5.0f, 0.0f, 0.0f}});
+
+    /* Only part of the first is in view, and the second only reaches the view once it is rotated */
+    GEOGL::Renderer2D::drawQuad({{10.4f, 0.0f, 0.0f}});
+    GEOGL::Renderer2D::drawRotatedQuad({{-10.6f, 0.0f, 0.0f}}, glm::radians(45.0f));
+
+    GEOGL::Renderer2D::drawQuads(outside.data(), outside.size());
+    GEOGL::Renderer2D::endScene();
+
+}
+
+TEST_CASE("Quads outside of the view are culled before they reach a batch", "[NullRenderer]"){
+
+    initNullRenderer();
+
+    const uint32_t insideCount = 10;
+    const uint32_t outsideCount = 7;
+
+    SECTION("Culling drops only the quads that do not overlap the view"){
+        GEOGL::Renderer2D::resetStats();
+        NullRendererAPI::resetRecording();
+
+        drawQuadsAroundView(insideCount, outsideCount);
+
+        auto stats = GEOGL::Renderer2D::getStatistics();
+        REQUIRE(stats.culledQuadCount == outsideCount);
+        REQUIRE(stats.quadCount == insideCount + 2);
+        REQUIRE(NullRendererAPI::getRecording().indexCount == (uint64_t) (insideCount + 2) * 6);
+    }
+
+    SECTION("Without culling every quad is drawn"){
+        GEOGL::Renderer2D::setViewCulling(false);
+        GEOGL::Renderer2D::resetStats();
+        NullRendererAPI::resetRecording();
+
+        drawQuadsAroundView(insideCount, outsideCount);
+        GEOGL::Renderer2D::setViewCulling(true);
+
+        auto stats = GEOGL::Renderer2D::getStatistics();
+        REQUIRE(stats.culledQuadCount == 0);
+        REQUIRE(stats.quadCount == insideCount + outsideCount + 2);
+        REQUIRE(NullRendererAPI::getRecording().indexCount == (uint64_t) (insideCount + outsideCount + 2) * 6);
+    }
+
+}
+
+TEST_CASE("A static batch draws once per set of textures, and is culled whole", "[NullRenderer]"){
+
+    initNullRenderer();
+
+    /* One texture per quad, so the batch needs several sets of texture slots */
+    const uint32_t quadCount = 40;
+    const uint32_t maxTextureSlots = GEOGL::Renderer2D::getMaxTextureSlots();
+    const uint32_t segmentCount = (quadCount + maxTextureSlots - 1) / maxTextureSlots;
+    REQUIRE(segmentCount > 1);
+
+    std::vector<GEOGL::Ref<GEOGL::Texture2D>> textures;
+    GEOGL::Renderer2D::StaticBatch batch;
+    for(uint32_t i = 0; i < quadCount; ++i){
+        textures.push_back(GEOGL::Texture2D::create(1, 1));
+        batch.drawQuad({{(float)(i % 8) - 4.0f, (float)(i / 8) - 2.0f, 0.0f}}, textures.back());
+    }
+
+    auto drawBatch = [&batch](const GEOGL::OrthographicCamera& camera){
+        GEOGL::Renderer2D::resetStats();
+        NullRendererAPI::resetRecording();
+
+        GEOGL::Renderer2D::beginScene(camera);
+        GEOGL::Renderer2D::drawStaticBatch(batch);
+        GEOGL::Renderer2D::endScene();
+    };
+
+    SECTION("The batch draws one segment per set of texture slots, and is only uploaded once"){
+        drawBatch(GEOGL::OrthographicCamera({-10.0f, 10.0f, -10.0f, 10.0f}));
+        REQUIRE(batch.isBuilt());
+
+        auto stats = GEOGL::Renderer2D::getStatistics();
+        REQUIRE(stats.drawCalls == segmentCount);
+        REQUIRE(stats.quadCount == quadCount);
+        REQUIRE(stats.culledQuadCount == 0);
+        REQUIRE(NullRendererAPI::getRecording().drawCalls == segmentCount);
+        REQUIRE(NullRendererAPI::getRecording().indexCount == (uint64_t) quadCount * 6);
+
+        drawBatch(GEOGL::OrthographicCamera({-10.0f, 10.0f, -10.0f, 10.0f}));
+        REQUIRE(GEOGL::Renderer2D::getStatistics().drawCalls == segmentCount);
+        REQUIRE(NullRendererAPI::getRecording().vertexBytes == 0);
+    }
+
+    SECTION("A batch outside of the view is culled without a draw"){
+        drawBatch(GEOGL::OrthographicCamera({90.0f, 110.0f, 90.0f, 110.0f}));
+
+        auto stats = GEOGL::Renderer2D::getStatistics();
+        REQUIRE(stats.drawCalls == 0);
+        REQUIRE(stats.quadCount == 0);
+        REQUIRE(stats.culledQuadCount == quadCount);
+        REQUIRE(NullRendererAPI::getRecording().drawCalls == 0);
+    }
+
+}
+
+TEST_CASE("A tile map draws and uploads only the chunks it has to", "[NullRenderer]"){
+
+    initNullRenderer();
+
+    /* 40 by 40 tiles in chunks of 16 is three chunks a side, from -20 to -4, -4 to 12 and 12 to 20 */
+    const uint32_t chunkSize = 16;
+    const uint64_t chunkBytes = chunkSize * chunkSize * 4;
+    GEOGL::TileMap tileMap(40, 40, GEOGL::Texture2D::create(64, 64), {16.0f, 16.0f}, chunkSize);
+    tileMap.setPosition({-20.0f, -20.0f, 0.0f});
+    for(uint32_t y = 0; y < tileMap.getHeight(); ++y){
+        for(uint32_t x = 0; x < tileMap.getWidth(); ++x){
+            tileMap.setTile(x, y, glm::uvec2(x % 4, y % 4));
+        }
+    }
+
+    /* The view covers the first two chunks along each axis */
+    auto drawTileMap = [&tileMap](){
+        GEOGL::Renderer2D::resetStats();
+        NullRendererAPI::resetRecording();
+
+        GEOGL::Renderer2D::beginScene(GEOGL::OrthographicCamera({-10.0f, 10.0f, -10.0f, 10.0f}));
+        GEOGL::Renderer2D::drawTileMap(tileMap);
+        GEOGL::Renderer2D::endScene();
+    };
+
+    drawTileMap();
+    auto stats = GEOGL::Renderer2D::getStatistics();
+    REQUIRE(stats.drawCalls == 4);
+    REQUIRE(stats.quadCount == 4);
+    REQUIRE(stats.culledQuadCount == 5);
+    REQUIRE(NullRendererAPI::getRecording().textureBytes == 4 * chunkBytes);
+
+    SECTION("Unchanged chunks are not uploaded again"){
+        drawTileMap();
+        REQUIRE(GEOGL::Renderer2D::getStatistics().drawCalls == 4);
+        REQUIRE(NullRendererAPI::getRecording().textureBytes == 0);
+    }
+
+    SECTION("Changing a tile uploads only its chunk"){
+        tileMap.setTile(20, 20, 0);
+        drawTileMap();
+        REQUIRE(NullRendererAPI::getRecording().textureBytes == chunkBytes);
+    }
+
+    SECTION("A changed chunk outside of the view waits until it is drawn"){
+        tileMap.setTile(39, 39, 0);
+        drawTileMap();
+        REQUIRE(NullRendererAPI::getRecording().textureBytes == 0);
+        REQUIRE(GEOGL::Renderer2D::getStatistics().culledQuadCount == 5);
+    }
+
+}
+
+TEST_CASE("The compact vertex format shrinks the vertex bytes of the same batches", "[NullRenderer]"){
+
+    initNullRenderer();
+
+    const uint32_t quadCount = 2500;
+    auto full = recordQuadGrid(quadCount);
+
+    GEOGL::Renderer2D::BatchProperties properties = getNullBatchProperties();
+    properties.vertexFormat = GEOGL::Renderer2D::VertexFormat::COMPACT;
+    NullBatchScope scope(properties);
+    auto compact = recordQuadGrid(quadCount);
+
+    REQUIRE(full.vertexBytes == (uint64_t) quadCount * 4 * 44);
+    REQUIRE(compact.vertexBytes == (uint64_t) quadCount * 4 * 24);
+    REQUIRE(compact.drawCalls == full.drawCalls);
+    REQUIRE(compact.indexCount == full.indexCount);
+
+}
+
+TEST_CASE("Instanced quads draw the same batches from a fraction of the vertex bytes", "[NullRenderer]"){
+
+    initNullRenderer();
+
+    const uint32_t quadCount = 2500;
+    auto vertices = recordQuadGrid(quadCount);
+
+    GEOGL::Renderer2D::BatchProperties properties = getNullBatchProperties();
+    properties.quadMode = GEOGL::Renderer2D::QuadMode::INSTANCED;
+    NullBatchScope scope(properties);
+    auto instanced = recordQuadGrid(quadCount);
+
+    REQUIRE(instanced.drawCalls == vertices.drawCalls);
+    REQUIRE(instanced.instancedDrawCalls == instanced.drawCalls);
+    REQUIRE(instanced.instanceCount == quadCount);
+    REQUIRE(instanced.indexCount == vertices.indexCount);
+
+    /* A 68 byte instance in place of four 44 byte vertices */
+    REQUIRE(instanced.vertexBytes == (uint64_t) quadCount * 68);
+    REQUIRE(instanced.vertexBytes * 2 < vertices.vertexBytes);
+
+}
+
+TEST_CASE("The Null backend measures Renderer2D batching throughput", "[NullRenderer][!benchmark]"){
+
+    initNullRenderer();
+
+    BENCHMARK("Draw 10000 flat quads"){
+        drawQuadGrid(10000);
+        return NullRendererAPI::getRecording().drawCalls;
+    };
+
+}
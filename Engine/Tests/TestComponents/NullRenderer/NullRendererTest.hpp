@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef GEOGL_NULLRENDERERTEST_HPP
+#define GEOGL_NULLRENDERERTEST_HPP
+
+#include <GEOGL/Renderer.hpp>
+#include <GEOGL/Platform/Null.hpp>
+
+using NullRendererAPI = GEOGL::Platform::Null::RendererAPI;
+
+static const uint32_t s_MaxQuads = 1000;
+
+/**
+ * The batch properties every test runs with, unless it changes them with a NullBatchScope.
+ */
+inline GEOGL::Renderer2D::BatchProperties getNullBatchProperties(){
+
+    GEOGL::Renderer2D::BatchProperties properties;
+    properties.maxQuads = s_MaxQuads;
+    properties.adaptiveBatchSize = false;
+    return properties;
+
+}
+
+/**
+ * Initializes the Renderer2D on the Null backend once, so the tests run on machines without a display or GPU.
+ */
+inline void initNullRenderer(){
+
+    static bool initialized = false;
+    if(initialized)
+        return;
+
+    if(!GEOGL::Log::isInitialized())
+        GEOGL::Log::init("NullRendererTest.log", "Null Renderer Test");
+
+    GEOGL::Renderer::setRendererAPI(GEOGL::RendererAPI::create(GEOGL::RendererAPI::RENDERING_NULL));
+    GEOGL::Renderer::init(getNullBatchProperties());
+
+    initialized = true;
+
+}
+
+/**
+ * Restarts the Renderer2D with other batch properties for the lifetime of the scope, then puts back the defaults,
+ * along with the submission mode and view culling, even when a REQUIRE fails.
+ */
+class NullBatchScope{
+public:
+    explicit NullBatchScope(const GEOGL::Renderer2D::BatchProperties& properties){
+
+        initNullRenderer();
+        GEOGL::Renderer2D::shutdown();
+        GEOGL::Renderer2D::init(properties);
+
+    }
+
+    ~NullBatchScope(){
+
+        GEOGL::Renderer2D::setSubmissionMode(GEOGL::Renderer2D::SubmissionMode::IMMEDIATE);
+        GEOGL::Renderer2D::setViewCulling(true);
+        GEOGL::Renderer2D::shutdown();
+        GEOGL::Renderer2D::init(getNullBatchProperties());
+
+    }
+
+    NullBatchScope(const NullBatchScope&) = delete;
+    NullBatchScope& operator=(const NullBatchScope&) = delete;
+};
+
+#endif //GEOGL_NULLRENDERERTEST_HPP
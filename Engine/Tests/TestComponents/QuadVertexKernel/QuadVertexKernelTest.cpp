@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include <GEOGL/Renderer.hpp>
+
+/* Mirrors the layout of the Renderer2D's vertex so the kernel is tested with the real stride */
+struct TestQuadVertex{
+    glm::vec3 position;
+    glm::vec4 color;
+    glm::vec2 textureCoord;
+    float tilingFactor;
+    float textureIndex;
+};
+
+static std::vector<GEOGL::Quad2DTransform> generateTransforms(size_t count){
+
+    std::vector<GEOGL::Quad2DTransform> transforms;
+    transforms.reserve(count);
+
+    for(size_t i = 0; i < count; ++i){
+        float t = (float)i;
+        transforms.push_back(GEOGL::Quad2DTransform::fromRotation({t * 0.25f - 50.0f, 30.0f - t * 0.125f, (float)(i % 7) * 0.1f},
+                                                                  {0.5f + (float)(i % 5), 2.0f - (float)(i % 3) * 0.5f},
+                                                                  (i % 4 == 0) ? 0.0f : t * 0.37f));
+    }
+
+    return transforms;
+
+}
+
+TEST_CASE("The QuadVertexKernel matches the glm::mat4 reference.", "[QuadVertexKernelTests]"){
+
+    std::cerr << "Testing the " << GEOGL::QuadVertexKernel::getInstructionSetName() << " quad vertex kernel\n";
+
+    /* 37 quads covers full AVX2 and SSE2 groups as well as the scalar remainder */
+    auto transforms = generateTransforms(37);
+    std::vector<TestQuadVertex> kernelVertices(transforms.size() * 4);
+    std::vector<TestQuadVertex> referenceVertices(transforms.size() * 4);
+
+    GEOGL::QuadVertexKernel::generateCorners(transforms.data(), transforms.size(), &kernelVertices[0].position, sizeof(TestQuadVertex));
+    GEOGL::QuadVertexKernel::generateCornersReference(transforms.data(), transforms.size(), &referenceVertices[0].position, sizeof(TestQuadVertex));
+
+    for(size_t i = 0; i < kernelVertices.size(); ++i){
+        REQUIRE(kernelVertices[i].position.x == Approx(referenceVertices[i].position.x).margin(1e-4));
+        REQUIRE(kernelVertices[i].position.y == Approx(referenceVertices[i].position.y).margin(1e-4));
+        REQUIRE(kernelVertices[i].position.z == Approx(referenceVertices[i].position.z).margin(1e-4));
+    }
+
+}
+
+TEST_CASE("The QuadVertexKernel only writes vertex positions.", "[QuadVertexKernelTests]"){
+
+    auto transforms = generateTransforms(9);
+    std::vector<TestQuadVertex> vertices(transforms.size() * 4);
+    for(auto& vertex : vertices){
+        vertex.color = {1,2,3,4};
+        vertex.textureCoord = {5,6};
+        vertex.tilingFactor = 7;
+        vertex.textureIndex = 8;
+    }
+
+    GEOGL::QuadVertexKernel::generateCorners(transforms.data(), transforms.size(), &vertices[0].position, sizeof(TestQuadVertex));
+
+    for(const auto& vertex : vertices){
+        REQUIRE(vertex.color == glm::vec4(1,2,3,4));
+        REQUIRE(vertex.textureCoord == glm::vec2(5,6));
+        REQUIRE(vertex.tilingFactor == 7);
+        REQUIRE(vertex.textureIndex == 8);
+    }
+
+}
+
+TEST_CASE("The half extents of a Quad2DTransform contain its corners.", "[QuadVertexKernelTests]"){
+
+    auto transforms = generateTransforms(37);
+    std::vector<TestQuadVertex> vertices(transforms.size() * 4);
+    GEOGL::QuadVertexKernel::generateCornersReference(transforms.data(), transforms.size(), &vertices[0].position, sizeof(TestQuadVertex));
+
+    for(size_t quad = 0; quad < transforms.size(); ++quad){
+        glm::vec2 halfExtents = transforms[quad].getHalfExtents();
+        glm::vec2 maxDistance{0.0f};
+
+        for(size_t corner = 0; corner < 4; ++corner){
+            glm::vec2 distance = glm::abs(glm::vec2(vertices[quad * 4 + corner].position - transforms[quad].position));
+            maxDistance = glm::max(maxDistance, distance);
+        }
+
+        /* The box around a rectangle touches its corners, so the extents are exact rather than just conservative */
+        REQUIRE(halfExtents.x == Approx(maxDistance.x).margin(1e-4));
+        REQUIRE(halfExtents.y == Approx(maxDistance.y).margin(1e-4));
+    }
+
+}
+
+TEST_CASE("A Quad2DTransform only overlaps bounds its box touches.", "[QuadVertexKernelTests]"){
+
+    GEOGL::Quad2DTransform square({0,0,0}, {2,2});
+    GEOGL::Quad2DTransform rotatedSquare = GEOGL::Quad2DTransform::fromRotation({0,0,0}, {2,2}, glm::radians(45.0f));
+
+    REQUIRE(square.overlaps({-1,-1}, {1,1}));
+    REQUIRE(square.overlaps({0.5f,0.5f}, {5,5}));
+    REQUIRE(square.overlaps({1,-1}, {2,1}));
+    REQUIRE_FALSE(square.overlaps({1.25f,-1}, {2,1}));
+    REQUIRE_FALSE(square.overlaps({-5,-5}, {-1.25f,5}));
+
+    /* Rotating by 45 degrees grows the box to sqrt(2) */
+    REQUIRE(rotatedSquare.overlaps({1.25f,-1}, {2,1}));
+    REQUIRE_FALSE(rotatedSquare.overlaps({1.5f,-1}, {2,1}));
+
+}
+
+TEST_CASE("Benchmarking the QuadVertexKernel against the glm::mat4 reference.", "[QuadVertexKernelTests][!benchmark]"){
+
+    auto transforms = generateTransforms(10000);
+    std::vector<TestQuadVertex> vertices(transforms.size() * 4);
+
+    BENCHMARK("glm::mat4 reference, 10000 quads"){
+        GEOGL::QuadVertexKernel::generateCornersReference(transforms.data(), transforms.size(), &vertices[0].position, sizeof(TestQuadVertex));
+        return vertices[0].position.x;
+    };
+
+    BENCHMARK("QuadVertexKernel, 10000 quads"){
+        GEOGL::QuadVertexKernel::generateCorners(transforms.data(), transforms.size(), &vertices[0].position, sizeof(TestQuadVertex));
+        return vertices[0].position.x;
+    };
+
+}
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include <GEOGL/Renderer.hpp>
+
+TEST_CASE("RadixSort sorts keys and keeps equal keys in order.", "[RadixSortTests]"){
+
+    std::mt19937_64 random(1234);
+    std::vector<GEOGL::SortEntry> entries;
+    std::vector<GEOGL::SortEntry> scratch;
+
+    /* Mix keys that only differ in a few bytes with fully random keys, so some passes get skipped */
+    for(uint32_t i = 0; i < 5000; ++i){
+        uint64_t key = (i % 3 == 0) ? random() : ((random() & 0xF) << 40) | (random() & 0xFF);
+        entries.push_back({key, i});
+    }
+
+    auto expected = entries;
+    std::stable_sort(expected.begin(), expected.end(), [](const GEOGL::SortEntry& a, const GEOGL::SortEntry& b){ return a.key < b.key; });
+
+    GEOGL::RadixSort::sort(entries, scratch);
+
+    REQUIRE(entries.size() == expected.size());
+    for(size_t i = 0; i < entries.size(); ++i){
+        REQUIRE(entries[i].key == expected[i].key);
+        REQUIRE(entries[i].index == expected[i].index);
+    }
+
+}
+
+TEST_CASE("RadixSort::floatToSortable keeps the order of floats.", "[RadixSortTests]"){
+
+    std::vector<float> values = {-1000.0f, -2.5f, -1.0f, -0.001f, 0.0f, 0.001f, 0.9f, 1.0f, 2.5f, 1000.0f};
+
+    for(size_t i = 1; i < values.size(); ++i){
+        REQUIRE(GEOGL::RadixSort::floatToSortable(values[i - 1]) < GEOGL::RadixSort::floatToSortable(values[i]));
+    }
+
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include "../NullRenderer/NullRendererTest.hpp"
+
+/**
+ * Draws a grid of quads, cycling through textures, into whatever draw is given.
+ */
+template<typename Draw>
+static void drawTexturedGrid(uint32_t firstQuad, uint32_t quadCount, const std::vector<GEOGL::Ref<GEOGL::Texture2D>>& textures, Draw draw){
+
+    for(uint32_t i = firstQuad; i < firstQuad + quadCount; ++i){
+        glm::vec3 position((float)(i % 100) * 2.0f - 99.0f, (float)(i / 100 % 100) * 2.0f - 99.0f, 0.0f);
+        draw(GEOGL::Renderer2D::QuadProperties{position, {1.0f, 1.0f}, {0.2f, 0.4f, 0.8f, 1.0f}}, textures[i % textures.size()]);
+    }
+
+}
+
+TEST_CASE("RecordingContexts finished on worker threads merge into the same batches as direct drawing", "[RecordingContext]"){
+
+    initNullRenderer();
+
+    /* More textures than a batch has slots, so both paths have to split batches on textures as well as quads */
+    std::vector<GEOGL::Ref<GEOGL::Texture2D>> textures;
+    for(uint32_t i = 0; i < GEOGL::Renderer2D::getMaxTextureSlots() + 3; ++i){
+        textures.push_back(GEOGL::Texture2D::create(1, 1));
+    }
+
+    /* Each worker starts where both the texture cycle and a batch do, so the batches split in the same places */
+    const uint32_t workerCount = 4;
+    const auto quadsPerWorker = (uint32_t)(GEOGL::Renderer2D::getMaxTextureSlots() * textures.size());
+    GEOGL::OrthographicCamera camera({-100.0f, 100.0f, -100.0f, 100.0f});
+
+    GEOGL::Renderer2D::resetStats();
+    NullRendererAPI::resetRecording();
+    GEOGL::Renderer2D::beginScene(camera);
+    drawTexturedGrid(0, workerCount * quadsPerWorker, textures, [](const auto& properties, const auto& texture){
+        GEOGL::Renderer2D::drawQuad(properties, texture);
+    });
+    GEOGL::Renderer2D::endScene();
+    auto directStatistics = GEOGL::Renderer2D::getStatistics();
+    auto directRecording = NullRendererAPI::getRecording();
+
+    std::vector<GEOGL::Renderer2D::RecordingContext> contexts(workerCount);
+    std::vector<std::thread> workers;
+    for(uint32_t worker = 0; worker < workerCount; ++worker){
+        workers.emplace_back([&, worker](){
+            auto& context = contexts[worker];
+            drawTexturedGrid(worker * quadsPerWorker, quadsPerWorker, textures, [&context](const auto& properties, const auto& texture){
+                context.drawQuad(properties, texture);
+            });
+            context.finish();
+        });
+    }
+    for(auto& worker : workers){
+        worker.join();
+    }
+
+    for(const auto& context : contexts){
+        REQUIRE(context.isFinished());
+    }
+
+    GEOGL::Renderer2D::resetStats();
+    NullRendererAPI::resetRecording();
+    GEOGL::Renderer2D::beginScene(camera);
+
+    /* Submitted backwards, so only the merge order puts them back in the order they were drawn directly */
+    for(uint32_t worker = workerCount; worker-- > 0;){
+        GEOGL::Renderer2D::submit(contexts[worker], worker);
+    }
+    GEOGL::Renderer2D::endScene();
+
+    auto mergedStatistics = GEOGL::Renderer2D::getStatistics();
+    const auto& mergedRecording = NullRendererAPI::getRecording();
+
+    REQUIRE(mergedStatistics.quadCount == workerCount * quadsPerWorker);
+    REQUIRE(mergedStatistics.quadCount == directStatistics.quadCount);
+    REQUIRE(mergedStatistics.drawCalls == directStatistics.drawCalls);
+    REQUIRE(mergedRecording.indexCount == directRecording.indexCount);
+    REQUIRE(mergedRecording.vertexBytes == directRecording.vertexBytes);
+
+    /* Recording into a finished context means its vertices have to be generated again */
+    contexts[0].drawQuad({{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 1.0f}});
+    REQUIRE_FALSE(contexts[0].isFinished());
+
+}
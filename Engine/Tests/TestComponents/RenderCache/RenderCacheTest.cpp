@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include "../NullRenderer/NullRendererTest.hpp"
+
+TEST_CASE("A RenderCache only renders again once it has been invalidated", "[RenderCache]"){
+
+    initNullRenderer();
+
+    GEOGL::RenderCache cache(64, 32);
+    uint32_t renders = 0;
+    auto render = [&renders](){ ++renders; };
+
+    REQUIRE(cache.isDirty());
+    uint32_t contentVersion = cache.getTexture()->getContentVersion();
+
+    REQUIRE(cache.update(render));
+    REQUIRE_FALSE(cache.update(render));
+    REQUIRE(renders == 1);
+    REQUIRE_FALSE(cache.isDirty());
+
+    /* Rendering changes the contents of the color attachment, so copies of it know they are stale */
+    REQUIRE(cache.getTexture()->getContentVersion() == contentVersion + 1);
+
+    cache.invalidate();
+    REQUIRE(cache.update(render));
+    REQUIRE(renders == 2);
+    REQUIRE(cache.getTexture()->getContentVersion() == contentVersion + 2);
+
+    /* Only an actual change of size invalidates the cache */
+    cache.resize(64, 32);
+    REQUIRE_FALSE(cache.isDirty());
+    cache.resize(128, 32);
+    REQUIRE(cache.isDirty());
+    REQUIRE(cache.update(render));
+    REQUIRE(renders == 3);
+
+    cache.setClearColor({1.0f, 0.0f, 0.0f, 1.0f});
+    REQUIRE(cache.isDirty());
+
+}
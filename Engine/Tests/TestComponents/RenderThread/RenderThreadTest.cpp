@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include <GEOGL/Renderer.hpp>
+
+TEST_CASE("A CommandList executes its commands in order, and destroys them after", "[RenderThread]"){
+
+    GEOGL::CommandList commandList;
+    std::vector<int> order;
+    auto capture = std::make_shared<int>(0);
+
+    int values[] = {1, 2, 3};
+    auto* staged = static_cast<const int*>(commandList.stage(values, sizeof(values)));
+    values[0] = 0;
+
+    for(int i = 0; i < 3; ++i){
+        commandList.record([&order, staged, i, capture](){ order.push_back(staged[i]); });
+    }
+    REQUIRE(commandList.getCommandCount() == 3);
+    REQUIRE(capture.use_count() == 4);
+
+    commandList.execute();
+
+    REQUIRE(order == std::vector<int>{1, 2, 3});
+    REQUIRE(commandList.getCommandCount() == 0);
+    REQUIRE(commandList.getUsedBytes() == 0);
+    REQUIRE(capture.use_count() == 1);
+
+}
+
+TEST_CASE("The RenderThread replays each frame on its own thread, in order", "[RenderThread]"){
+
+    if(!GEOGL::Log::isInitialized())
+        GEOGL::Log::init("RenderThreadTest.log", "Render Thread Test");
+
+    GEOGL::RenderThread::setEnabled(true, 2);
+    GEOGL::RenderThread::start(nullptr);
+    REQUIRE(GEOGL::RenderThread::isRunning());
+
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::vector<int> order;
+    std::atomic<bool> onRenderThread{true};
+
+    const int frames = 100;
+    for(int frame = 0; frame < frames; ++frame){
+        GEOGL::RenderThread::submit([&order, &onRenderThread, mainThread, frame](){
+            if(std::this_thread::get_id() == mainThread)
+                onRenderThread = false;
+            order.push_back(frame);
+        });
+        GEOGL::RenderThread::endFrame();
+    }
+
+    /* Executing waits, so whatever it writes is visible as soon as it returns */
+    bool executed = false;
+    GEOGL::RenderThread::execute([&executed](){ executed = GEOGL::RenderThread::isRenderThread(); });
+    REQUIRE(executed);
+
+    GEOGL::RenderThread::stop();
+    GEOGL::RenderThread::setEnabled(false);
+    REQUIRE_FALSE(GEOGL::RenderThread::isRunning());
+
+    REQUIRE(onRenderThread);
+    REQUIRE(order.size() == frames);
+    for(int frame = 0; frame < frames; ++frame){
+        REQUIRE(order[frame] == frame);
+    }
+
+    /* Once stopped, commands run immediately again */
+    bool ranImmediately = false;
+    GEOGL::RenderThread::submit([&ranImmediately](){ ranImmediately = true; });
+    REQUIRE(ranImmediately);
+
+}
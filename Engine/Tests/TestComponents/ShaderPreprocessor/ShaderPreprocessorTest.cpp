@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include "../NullRenderer/NullRendererTest.hpp"
+
+static const char* s_FixtureFolder = "Resources/Shaders/Preprocessor";
+
+TEST_CASE("The ShaderPreprocessor resolves includes and defines", "[ShaderPreprocessor]"){
+
+    GEOGL::ShaderDefines defines = {{"GEOGL_TEXTURED", "0"}};
+    std::string source = GEOGL::ShaderPreprocessor::process("#type vertex\n#version 330 core\n#include <GEOGL/Camera.glsl>\n", ".", defines);
+
+    REQUIRE(source.find("#version 330 core\n#define GEOGL_TEXTURED 0\n") != std::string::npos);
+    REQUIRE(source.find("uniform Camera") != std::string::npos);
+    REQUIRE(source.find("#include") == std::string::npos);
+
+    REQUIRE(GEOGL::ShaderPreprocessor::getVariantKey("Texture", defines) == "Texture|GEOGL_TEXTURED=0");
+    REQUIRE(GEOGL::ShaderPreprocessor::getVariantKey("Texture", {}) != GEOGL::ShaderPreprocessor::getVariantKey("Texture", defines));
+
+    initNullRenderer();
+
+    GEOGL::ShaderLibrary library;
+    auto colorVariant = library.getVariant("Resources/Shaders/Quad", defines);
+    REQUIRE(library.getVariant("Resources/Shaders/Quad", defines) == colorVariant);
+    REQUIRE(library.getVariant("Resources/Shaders/Quad", {}) != colorVariant);
+
+}
+
+TEST_CASE("The ShaderPreprocessor resolves quoted includes relative to the including file", "[ShaderPreprocessor]"){
+
+    /* Color.glsl includes "Constants.glsl", which lives next to it rather than next to the shader */
+    std::string source = GEOGL::ShaderPreprocessor::process("#include \"Common/Color.glsl\"\n", s_FixtureFolder, {});
+
+    REQUIRE(source.find("#define COLOR_VALUE 1.0") != std::string::npos);
+    REQUIRE(source.find("vec4 getColor()") != std::string::npos);
+    REQUIRE(source.find("#define COLOR_VALUE 1.0") < source.find("vec4 getColor()"));
+    REQUIRE(source.find("#include") == std::string::npos);
+
+}
+
+TEST_CASE("The ShaderPreprocessor stops at include cycles", "[ShaderPreprocessor]"){
+
+    std::string source = GEOGL::ShaderPreprocessor::process("#include \"Cycle/A.glsl\"\n", s_FixtureFolder, {});
+
+    REQUIRE(source.find("// A") != std::string::npos);
+    REQUIRE(source.find("// B") != std::string::npos);
+    REQUIRE(source.find("// A") == source.rfind("// A"));
+    REQUIRE(source.find("// B") == source.rfind("// B"));
+    REQUIRE(source.find("#include") == std::string::npos);
+
+}
+
+TEST_CASE("The ShaderPreprocessor leaves out includes it cannot resolve", "[ShaderPreprocessor]"){
+
+    std::string source = GEOGL::ShaderPreprocessor::process("before\n#include \"Missing.glsl\"\n#include <GEOGL/Missing.glsl>\nafter\n", s_FixtureFolder, {});
+
+    REQUIRE(source == "before\nafter\n");
+
+}
+
+TEST_CASE("The Renderer2D shaders are built into the engine", "[ShaderPreprocessor]"){
+
+    for(const char* name : {"GEOGL/Renderer2D/Texture.glsl", "GEOGL/Renderer2D/TextureInstanced.glsl", "GEOGL/Renderer2D/TileMap.glsl"}){
+        std::string source = GEOGL::ShaderPreprocessor::process(std::string("#include <") + name + ">\n", s_FixtureFolder, {});
+
+        REQUIRE(source.find("#type vertex") != std::string::npos);
+        REQUIRE(source.find("#type fragment") != std::string::npos);
+        REQUIRE(source.find("uniform Camera") != std::string::npos);
+        REQUIRE(source.find("#include") == std::string::npos);
+    }
+
+}
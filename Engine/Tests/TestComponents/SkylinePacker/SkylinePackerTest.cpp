@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+
+#include <Catch/Catch2.hpp>
+#include <GEOGL/Renderer.hpp>
+
+struct PackedRect{
+    glm::uvec2 position;
+    glm::uvec2 size;
+};
+
+static bool overlaps(const PackedRect& a, const PackedRect& b){
+
+    return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+           a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+
+}
+
+TEST_CASE("The SkylinePacker places rectangles inside of its area without overlapping.", "[SkylinePackerTests]"){
+
+    std::mt19937 random(1234);
+    GEOGL::SkylinePacker packer(512, 512);
+    std::vector<PackedRect> rects;
+
+    for(int i = 0; i < 400; ++i){
+        glm::uvec2 size = {8 + random() % 40, 8 + random() % 40};
+        glm::uvec2 position;
+        if(!packer.insert(size.x, size.y, position))
+            continue;
+
+        REQUIRE(position.x + size.x <= 512);
+        REQUIRE(position.y + size.y <= 512);
+        rects.push_back({position, size});
+    }
+
+    REQUIRE(rects.size() > 100);
+    for(size_t a = 0; a < rects.size(); ++a){
+        for(size_t b = a + 1; b < rects.size(); ++b){
+            REQUIRE_FALSE(overlaps(rects[a], rects[b]));
+        }
+    }
+
+}
+
+TEST_CASE("The SkylinePacker fills its area with equal rectangles and then rejects them.", "[SkylinePackerTests]"){
+
+    GEOGL::SkylinePacker packer(64, 64);
+    glm::uvec2 position;
+
+    for(int i = 0; i < 16; ++i){
+        REQUIRE(packer.insert(16, 16, position));
+    }
+
+    REQUIRE(packer.getUsedArea() == 64 * 64);
+    REQUIRE_FALSE(packer.insert(1, 1, position));
+    REQUIRE_FALSE(packer.insert(65, 1, position));
+
+    packer.reset();
+    REQUIRE(packer.insert(64, 64, position));
+    REQUIRE(position == glm::uvec2(0, 0));
+
+}
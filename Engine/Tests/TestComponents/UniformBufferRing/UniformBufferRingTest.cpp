@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include "../NullRenderer/NullRendererTest.hpp"
+
+TEST_CASE("A UniformBufferRing aligns its slots and wraps around to the first one", "[UniformBufferRing]"){
+
+    initNullRenderer();
+
+    const uint32_t alignment = GEOGL::RenderCommand::getCapabilities().uniformBufferOffsetAlignment;
+    const uint32_t slotCount = 3;
+    GEOGL::UniformBufferRing ring(sizeof(glm::mat4) + 4, slotCount, 5);
+
+    REQUIRE(ring.getStride() % alignment == 0);
+    REQUIRE(ring.getStride() >= ring.getBlockSize());
+    REQUIRE(ring.getBuffer()->getSize() == ring.getStride() * slotCount);
+    REQUIRE(ring.getBuffer()->getBinding() == 5);
+
+    uint8_t block[sizeof(glm::mat4) + 4] = {};
+    NullRendererAPI::resetRecording();
+
+    for(uint32_t slot = 0; slot < slotCount; ++slot){
+        REQUIRE(ring.push(block) == slot * ring.getStride());
+    }
+
+    /* Every slot is taken, so the next block goes back to the start */
+    REQUIRE(ring.push(block) == 0);
+    REQUIRE(ring.push(block) == ring.getStride());
+
+    const auto& recording = NullRendererAPI::getRecording();
+    REQUIRE(recording.uniformBytes == (uint64_t) ring.getBlockSize() * (slotCount + 2));
+    REQUIRE(recording.bufferBinds == slotCount + 2);
+
+}
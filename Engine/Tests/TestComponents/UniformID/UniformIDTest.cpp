@@ -0,0 +1,41 @@
+/*******************************************************************************
+ * Copyright (c) 2020 Matthew Krueger                                          *
+ *                                                                             *
+ * This software is provided 'as-is', without any express or implied           *
+ * warranty. In no event will the authors be held liable for any damages       *
+ * arising from the use of this software.                                      *
+ *                                                                             *
+ * Permission is granted to anyone to use this software for any purpose,       *
+ * including commercial applications, and to alter it and redistribute it      *
+ * freely, subject to the following restrictions:                              *
+ *                                                                             *
+ * 1. The origin of this software must not be misrepresented; you must not     *
+ *    claim that you wrote the original software. If you use this software     *
+ *    in a product, an acknowledgment in the product documentation would       *
+ *    be appreciated but is not required.                                      *
+ *                                                                             *
+ * 2. Altered source versions must be plainly marked as such, and must not     *
+ *    be misrepresented as being the original software.                        *
+ *                                                                             *
+ * 3. This notice may not be removed or altered from any source                *
+ *    distribution.                                                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#include <Catch/Catch2.hpp>
+#include <GEOGL/Renderer.hpp>
+
+TEST_CASE("UniformIDs hash uniform names at compile time", "[UniformID]"){
+
+    static constexpr GEOGL::UniformID projectionViewMatrix = "u_ProjectionViewMatrix";
+    static_assert(projectionViewMatrix.getHash() == GEOGL::UniformID::hash("u_ProjectionViewMatrix"));
+
+    std::string formattedName = GEOGL_FORMAT("u_Textures[{}]", 3);
+    REQUIRE(GEOGL::UniformID(formattedName.c_str()) == GEOGL::UniformID("u_Textures[3]"));
+    REQUIRE_FALSE(GEOGL::UniformID("u_Textures[3]") == GEOGL::UniformID("u_Textures[4]"));
+    REQUIRE_FALSE(GEOGL::UniformID("u_Textures") == projectionViewMatrix);
+
+    /* FNV-1a of the empty string is its offset basis */
+    REQUIRE(GEOGL::UniformID("").getHash() == 2166136261u);
+
+}
@@ -84,7 +84,11 @@ namespace TwoDGame{
             ImGui::Text("2D Draw Calls %d", GEOGL::Renderer2D::getStatistics().drawCalls);
             ImGui::Text("2D Quads %d", GEOGL::Renderer2D::getStatistics().quadCount);
             ImGui::Text("2D Vertices %d", GEOGL::Renderer2D::getStatistics().getTotalVertexCount());
+            ImGui::Text("2D Culled Quads %d", GEOGL::Renderer2D::getStatistics().culledQuadCount);
             ImGui::Text("2D Indices %d", GEOGL::Renderer2D::getStatistics().getTotalIndexCount());
+            ImGui::Text("Shader Cache Hits %d, Misses %d", GEOGL::Shader::getCacheStatistics().hits, GEOGL::Shader::getCacheStatistics().misses);
+            ImGui::Text("State Changes Issued %llu, Skipped %llu", (unsigned long long) GEOGL::RenderCommand::getStateChangeStatistics().issued,
+                        (unsigned long long) GEOGL::RenderCommand::getStateChangeStatistics().skipped);
             ImGui::Text("Window size %d x %d", dimensions.x, dimensions.y);
             ImGui::Text("Aspect Ratio %f", (float)dimensions.x/(float)dimensions.y);
             ImGui::Text("VSync Enabled: %s", (GEOGL::Application::get().getWindow().isVSync()) ? "TRUE" : "FALSE");
@@ -65,13 +65,20 @@ namespace TwoDGame{
         m_TextureBarrel = GEOGL::SubTexture2D::createFromCoords(m_SpriteSheet, {9,2}, {128,128});
         m_TextureStairs = GEOGL::SubTexture2D::createFromCoords(m_SpriteSheet, {7,6}, {128,128});
         m_TextureTree = GEOGL::SubTexture2D::createFromCoords(m_SpriteSheet, {2,1}, {128,128}, {1,2});
-        m_TextureError = GEOGL::Texture2D::create(1,1);
-        uint32_t pinkColor = 0xFF7F00FF;
-        m_TextureError->setData(&pinkColor, sizeof(pinkColor));
+        m_TileMap = GEOGL::createScope<GEOGL::TileMap>(s_MapWidth, s_MapHeight, m_SpriteSheet, glm::vec2{128,128});
+        m_TileMap->setPosition({-(float)s_MapWidth / 2 - 0.5f, -(float)s_MapHeight / 2 + 0.5f, 0});
 
+        m_TileCoords['D'] = {6,11};
+        m_TileCoords['W'] = {11,11};
 
-        m_TextureMap['D'] = GEOGL::SubTexture2D::createFromCoords(m_SpriteSheet, {6,11}, {128,128});
-        m_TextureMap['W'] = GEOGL::SubTexture2D::createFromCoords(m_SpriteSheet, {11,11}, {128,128});
+        /* The map string starts at the top row, while the tile map starts at the bottom. Unknown tiles are left empty */
+        for(uint32_t y=0; y < s_MapHeight; ++y){
+            for(uint32_t x=0; x < s_MapWidth; ++x){
+                auto tileCoords = m_TileCoords.find(s_MapTiles[x+(y*s_MapWidth)]);
+                if(tileCoords != m_TileCoords.end())
+                    m_TileMap->setTile(x, s_MapHeight - 1 - y, tileCoords->second);
+            }
+        }
 
 
         m_OrthographicCameraController.setZoomLevel(5);
@@ -93,15 +100,7 @@ namespace TwoDGame{
 
         GEOGL::Renderer2D::beginScene(m_OrthographicCameraController.getCamera());
 
-        for(uint32_t y=0; y < s_MapHeight; ++y){
-            for(uint32_t x=0; x < s_MapWidth; ++x){
-                if(m_TextureMap.find(s_MapTiles[x+(y*s_MapWidth)]) != m_TextureMap.end()) {
-                    GEOGL::Renderer2D::drawQuad({{(float) x - ((float) s_MapWidth / 2), ((float) s_MapHeight / 2) - (float)y, 0},{1,1}}, m_TextureMap[s_MapTiles[x+(y*s_MapWidth)]]);
-                }else{
-                    GEOGL::Renderer2D::drawQuad({{(float) x - ((float) s_MapWidth / 2), ((float) s_MapHeight / 2) - (float)y, 0},{1,1}}, m_TextureError);
-                }
-            }
-        }
+        GEOGL::Renderer2D::drawTileMap(*m_TileMap);
 
         GEOGL::Renderer2D::endScene();
 
@@ -52,10 +52,13 @@ namespace TwoDGame{
         GEOGL::Ref<GEOGL::SubTexture2D> m_TextureStairs;
         GEOGL::Ref<GEOGL::SubTexture2D> m_TextureBarrel;
         GEOGL::Ref<GEOGL::SubTexture2D> m_TextureTree;
-        GEOGL::Ref<GEOGL::Texture2D> m_TextureError;
 
 
-        std::unordered_map<char, GEOGL::Ref<GEOGL::SubTexture2D>> m_TextureMap;
+        /* The cell of the sprite sheet each character of the map is drawn with */
+        std::unordered_map<char, glm::uvec2> m_TileCoords;
+
+        /* Every chunk of the map is drawn as a single quad, with the tiles looked up in the fragment shader */
+        GEOGL::Scope<GEOGL::TileMap> m_TileMap;
 
 
     };
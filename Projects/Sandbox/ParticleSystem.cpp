@@ -38,6 +38,7 @@ namespace SandboxApp{
     ParticleSystem::ParticleSystem(uint32_t maxParticles) : m_PoolIndex(maxParticles-1){
         Random::Init();
         m_ParticlePool.resize(maxParticles);
+        m_QuadInstances.reserve(maxParticles);
     }
 
     void ParticleSystem::onUpdate(GEOGL::TimeStep ts){
@@ -62,7 +63,7 @@ namespace SandboxApp{
 
     void ParticleSystem::onRender(const GEOGL::OrthographicCamera& camera){
 
-        GEOGL::Renderer2D::beginScene(camera);
+        m_QuadInstances.clear();
 
         for (auto& particle : m_ParticlePool){
             if (!particle.active)
@@ -75,10 +76,12 @@ namespace SandboxApp{
 
             float size = glm::lerp(particle.sizeEnd, particle.sizeBegin, life);
 
-            GEOGL::Renderer2D::drawRotatedQuad({{particle.position.xy, .9f}, {size, size}, color}, particle.rotation);
+            m_QuadInstances.emplace_back(glm::vec3{particle.position.xy, .9f}, glm::vec2{size, size}, color, particle.rotation);
 
         }
 
+        GEOGL::Renderer2D::beginScene(camera);
+        GEOGL::Renderer2D::drawQuads(m_QuadInstances.data(), m_QuadInstances.size());
         GEOGL::Renderer2D::endScene();
 
     }
@@ -27,6 +27,7 @@
 
 #define GEOGL_SWIZZLE
 #include <GEOGL/Core.hpp>
+#include <GEOGL/Renderer.hpp>
 #include <random>
 
 
@@ -83,6 +84,9 @@ namespace SandboxApp{
         std::vector<Particle> m_ParticlePool;
         uint32_t m_PoolIndex;
 
+        /* Reused every frame to submit the active particles in one call */
+        std::vector<GEOGL::Renderer2D::QuadInstance> m_QuadInstances;
+
     };
 
 }